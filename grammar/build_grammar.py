@@ -25,22 +25,27 @@ def load_config() -> Dict[str, Any]:
 
 def output_table_c(table: Dict[str, Dict[str, List[str]]], source_fname: str, header_fname: str):
 
-    # hash function and mod found with `bruteforce_hash.py`
-    def hash_nt(nti, ti):
-        return ((nti << shift) + ti) % mod
-
-    def hash_t(nti, ti):
-        return ((ti << shift) + nti) % mod
-
+    # the enum order comes from the brute-forced configuration, the scanner tables depend on it
     config = load_config()
-    mod = config['mod']
     nts = config['nts']
     ts = config['ts']
-    shift = config['shift']
-    nt_main = config['nt-main']
-    hashf = hash_nt if nt_main else hash_t
 
-    total_exp_len = sum(sum(len(exp) for exp in expd.values() if exp != [EPS]) for nterm, expd in table.items())
+    # pool identical expansions once, entries of the table index into it
+    pool: List[str] = []
+    pool_offsets: Dict[Tuple[str, ...], int] = {}
+    for nterm in nts:
+        for term in ts:
+            exp = table[nterm].get(term)
+            if not exp or exp == [EPS] or tuple(exp) in pool_offsets:
+                continue
+            pool_offsets[tuple(exp)] = len(pool)
+            pool += exp
+
+    def format_nut(token: str) -> str:
+        token_name = get_token_name(token)
+        if token in nts:
+            return f'{{ .is_nterm = true, .nterm = NT_{token_name} }}'
+        return f'{{ .term = T_{token_name} }}'
 
     # generate source file
     with open(source_fname, 'w') as f:
@@ -48,26 +53,7 @@ def output_table_c(table: Dict[str, Dict[str, List[str]]], source_fname: str, he
         f.write( '#include <stdio.h>\n')
         f.write( '#include <stdlib.h>\n')
         f.write( '#include <stdbool.h>\n\n')
-        f.write( '#include "parser-generated.h"\n')
-        f.write( '#include "error.h"\n\n')
-        f.write( 'parser_table_t *table;\n\n')
-        f.write( 'static struct {\n')
-        f.write( '    void *data;\n')
-        f.write( '    size_t size;\n')
-        f.write( '    size_t offset;\n')
-        f.write( '} mempool;\n\n')
-        f.write( 'static void *alloc_tokens(size_t n_tokens)\n')
-        f.write( '{\n')
-        f.write( '    void *ret = (uint8_t *) mempool.data + mempool.offset;\n')
-        f.write( '    mempool.offset += n_tokens * sizeof(nut_type_t);\n')
-        f.write( '    return ret;\n')
-        f.write( '}\n')
-        f.write( 'size_t parser_get_table_index(nterm_type_t nterm, term_type_t term)\n{\n')
-        if nt_main:
-            f.write(f'    return ((nterm << {shift}) + term) % {mod};\n')
-        else:
-            f.write(f'    return ((term << {shift}) + nterm) % {mod};\n')
-        f.write( '}\n')
+        f.write( '#include "parser-generated.h"\n\n')
 
         # generate pretty-print functions for tokens
         f.write('const char *nterm_to_readable(nterm_type_t nterm)\n{\n')
@@ -88,54 +74,29 @@ def output_table_c(table: Dict[str, Dict[str, List[str]]], source_fname: str, he
             f.write(f'        return "{term}";\n')
         f.write('    }\n')
         f.write('    return "<unknown-term>";\n')
-        f.write('}\n')
-
-        f.write( 'int parser_init()\n{\n')
-        f.write( '    mempool.offset = 0;\n')
-        f.write(f'    mempool.data = calloc({total_exp_len}, sizeof(nut_type_t));\n')
-        f.write( '    if(mempool.data == NULL) {\n')
-        f.write( '        return E_INT;\n')
-        f.write( '    }\n')
-        f.write(f'    mempool.size = {total_exp_len} * sizeof(nut_type_t);\n\n')
-        f.write(f'    size_t rule_count = {mod};\n')
-        f.write( '    table = calloc(1, sizeof(parser_table_t) + rule_count * sizeof(exp_list_t));\n')
-        f.write( '    if(table == NULL) {\n')
-        f.write( '        return E_INT;\n')
-        f.write( '    }\n\n')
-        f.write( '    table->bucket_count = rule_count;\n')
-
-        index_set = set()
-        for nterm, expd in table.items():
-            for term, exp in expd.items():
-
-                nti = nts.index(nterm)
-                ti = ts.index(term)
-                table_ix = hashf(nti, ti)
-                if table_ix in index_set:
-                    print(f'error: index {table_ix} occurs multiple times')
-                index_set.add(table_ix)
-
-                # epsilon expansion
-                if exp == [EPS]:
-                    f.write(f'    table->data[{table_ix}] = (exp_list_t){{ .valid = true, .size = 0 }};\n')
-                    continue
+        f.write('}\n\n')
 
-                f.write(f'    table->data[{table_ix}] = (exp_list_t){{ .valid = true, .size = {len(exp)}, .data = alloc_tokens({len(exp)}) }};\n')
+        f.write(f'const nut_type_t parser_rules[{len(pool)}] = {{\n')
+        for token in pool:
+            f.write(f'    {format_nut(token)},\n')
+        f.write('};\n\n')
 
-                for i, token in enumerate(exp):
-                    token_name = get_token_name(token)
-                    if token in nts:
-                        f.write(f'    table->data[{table_ix}].data[{i}].is_nterm = true;\n')
-                        f.write(f'    table->data[{table_ix}].data[{i}].nterm = NT_{token_name};\n')
-                    else:
-                        f.write(f'    table->data[{table_ix}].data[{i}].term = T_{token_name};\n')
-        f.write('    return E_OK;\n')
-        f.write('}\n')
-
-        f.write('void parser_free()\n{\n')
-        f.write('    free(table);\n')
-        f.write('    free(mempool.data);\n')
-        f.write('}\n')
+        f.write('const exp_list_t parser_table[NTERM_COUNT][TERM_COUNT] = {\n')
+        for nterm in nts:
+            expd = table[nterm]
+            if not expd:
+                continue
+            f.write(f'    [NT_{get_token_name(nterm)}] = {{\n')
+            for term in ts:
+                if term not in expd:
+                    continue
+                exp = expd[term]
+                if exp == [EPS]:
+                    f.write(f'        [T_{get_token_name(term)}] = {{ .valid = true }},\n')
+                else:
+                    f.write(f'        [T_{get_token_name(term)}] = {{ .offset = {pool_offsets[tuple(exp)]}, .size = {len(exp)}, .valid = true }},\n')
+            f.write('    },\n')
+        f.write('};\n')
 
     with open(header_fname, 'w') as f:
         f.write(f'/*\n * This file was generated by {sys.argv[0]}, DO NOT MODIFY!\n */\n')
@@ -145,6 +106,8 @@ def output_table_c(table: Dict[str, Dict[str, List[str]]], source_fname: str, he
         f.write('#include <stdbool.h>\n\n')
         f.write('#include "type.h"\n')
         f.write('#include "dynstring.h"\n\n')
+        f.write(f'#define NTERM_COUNT {len(nts)}\n')
+        f.write(f'#define TERM_COUNT {len(ts)}\n\n')
         f.write('// order of these two enums is crucial\n')
         f.write('typedef enum\n{\n')
         for nterm in nts:
@@ -168,23 +131,18 @@ def output_table_c(table: Dict[str, Dict[str, List[str]]], source_fname: str, he
         f.write('} nut_type_t;\n')
         f.write('\n')
         f.write('typedef struct {\n')
-        f.write('    size_t size;\n')
-        f.write('    nut_type_t *data;\n')
-        f.write('    bool valid;\n')
+        f.write('    uint16_t offset; ///< index of the first nut in parser_rules\n')
+        f.write('    uint8_t size;    ///< number of nuts, zero for epsilon\n')
+        f.write('    bool valid;      ///< false if there is no expansion\n')
         f.write('} exp_list_t;\n')
         f.write('\n')
-        f.write('// hashmap without collisions\n')
-        f.write('typedef struct {\n')
-        f.write('    size_t bucket_count;\n')
-        f.write('    exp_list_t data[];\n')
-        f.write('} parser_table_t;\n\n')
 
-        f.write('size_t parser_get_table_index(nterm_type_t nterm, term_type_t term);\n')
         f.write('const char *nterm_to_readable(nterm_type_t nterm);\n')
-        f.write('const char *term_to_readable(term_type_t term);\n')
-        f.write('int parser_init();\n')
-        f.write('void parser_free();\n\n')
-        f.write('extern parser_table_t *table;\n')
+        f.write('const char *term_to_readable(term_type_t term);\n\n')
+        f.write('/// right sides of all expansions\n')
+        f.write(f'extern const nut_type_t parser_rules[{len(pool)}];\n')
+        f.write('/// LL table indexed by the expanded nterm and the following term\n')
+        f.write('extern const exp_list_t parser_table[NTERM_COUNT][TERM_COUNT];\n')
 
 
 
@@ -0,0 +1,127 @@
+##
+# @file build_keywords.py
+# @author xkrato61 Pavel Kratochvil
+#
+# @brief bruteforce a collision-free hash over reserved keywords and generate the scanner lookup table
+#
+
+from typing import List, Optional, Tuple
+import sys
+
+# keyword, token type, token attribute (type_t for T_TYPE, bool for T_BOOL)
+keywords: List[Tuple[str, str, str]] = [
+    ('if', 'T_IF', '0'),
+    ('else', 'T_ELSE', '0'),
+    ('do', 'T_DO', '0'),
+    ('end', 'T_END', '0'),
+    ('function', 'T_FUNCTION', '0'),
+    ('global', 'T_GLOBAL', '0'),
+    ('nil', 'T_NIL', '0'),
+    ('require', 'T_REQUIRE', '0'),
+    ('return', 'T_RETURN', '0'),
+    ('while', 'T_WHILE', '0'),
+    ('then', 'T_THEN', '0'),
+    ('integer', 'T_TYPE', 'TYPE_INTEGER'),
+    ('number', 'T_TYPE', 'TYPE_NUMBER'),
+    ('local', 'T_LOCAL', '0'),
+    ('string', 'T_TYPE', 'TYPE_STRING'),
+    ('boolean', 'T_TYPE', 'TYPE_BOOL'),
+    ('true', 'T_BOOL', 'true'),
+    ('false', 'T_BOOL', 'false'),
+    ('elseif', 'T_ELSEIF', '0'),
+    ('repeat', 'T_REPEAT', '0'),
+    ('until', 'T_UNTIL', '0'),
+    ('break', 'T_BREAK', '0'),
+    ('not', 'T_NOT', '0'),
+    ('and', 'T_AND', '0'),
+    ('or', 'T_OR', '0'),
+    ('for', 'T_FOR', '0'),
+]
+
+MAX_SHIFT = 8
+
+
+def hash(word: str, first_shift: int, last_shift: int, mod: int) -> int:
+    return ((ord(word[0]) << first_shift) + (ord(word[-1]) << last_shift) + len(word)) % mod
+
+
+def bruteforce() -> Tuple[int, int, int]:
+    # smallest table first, then any shift combination that separates all keywords
+    for mod in range(len(keywords), 1024):
+        for first_shift in range(MAX_SHIFT):
+            for last_shift in range(MAX_SHIFT):
+                indices = {hash(kw, first_shift, last_shift, mod) for kw, _, _ in keywords}
+                if len(indices) == len(keywords):
+                    return first_shift, last_shift, mod
+    print('error: no collision-free hash found', file=sys.stderr)
+    exit(1)
+
+
+def output_header(header_fname: str, first_shift: int, last_shift: int, mod: int):
+    slots: List[Optional[Tuple[str, str, str]]] = [None] * mod
+    for kw in keywords:
+        slots[hash(kw[0], first_shift, last_shift, mod)] = kw
+
+    min_length = min(len(kw) for kw, _, _ in keywords)
+    max_length = max(len(kw) for kw, _, _ in keywords)
+
+    with open(header_fname, 'w') as f:
+        f.write(f'/*\n * This file was generated by {sys.argv[0]}, DO NOT MODIFY!\n */\n')
+        f.write('#pragma once\n\n')
+        f.write('#include <stdbool.h>\n')
+        f.write('#include <stddef.h>\n')
+        f.write('#include <stdint.h>\n')
+        f.write('#include <string.h>\n\n')
+        f.write('#include "parser-generated.h"\n')
+        f.write('#include "type.h"\n\n')
+        f.write(f'#define KEYWORD_MIN_LENGTH ({min_length})\n')
+        f.write(f'#define KEYWORD_MAX_LENGTH ({max_length})\n')
+        f.write(f'#define KEYWORD_TABLE_SIZE ({mod})\n\n')
+        f.write('typedef struct {\n')
+        f.write('    const char *name;       ///< keyword, empty slots have length 0\n')
+        f.write('    uint8_t length;         ///< length of name\n')
+        f.write('    term_type_t token_type; ///< token type of keyword\n')
+        f.write('    int value;              ///< type_t for T_TYPE, bool for T_BOOL\n')
+        f.write('} keyword_t;\n\n')
+        f.write('static const keyword_t keyword_table[KEYWORD_TABLE_SIZE] = {\n')
+        for slot in slots:
+            if slot is None:
+                f.write('    { "", 0, T_IDENTIFIER, 0 },\n')
+            else:
+                kw, token_type, value = slot
+                f.write(f'    {{ "{kw}", {len(kw)}, {token_type}, {value} }},\n')
+        f.write('};\n\n')
+        f.write('/**\n')
+        f.write(' * @brief Looks up a reserved keyword using one hash and one memcmp\n')
+        f.write(' *\n')
+        f.write(' * @param s identifier, doesn\'t have to be null terminated\n')
+        f.write(' * @param length length of identifier\n')
+        f.write(' * @return keyword entry or NULL if s isn\'t a keyword\n')
+        f.write(' */\n')
+        f.write('static inline const keyword_t *keyword_lookup(const char *s, size_t length)\n')
+        f.write('{\n')
+        f.write('    if(length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH) {\n')
+        f.write('        return NULL;\n')
+        f.write('    }\n')
+        f.write(f'    size_t index = (((size_t)(unsigned char) s[0] << {first_shift}) +\n')
+        f.write(f'                    ((size_t)(unsigned char) s[length - 1] << {last_shift}) + length) %\n')
+        f.write('                   KEYWORD_TABLE_SIZE;\n')
+        f.write('    const keyword_t *keyword = &keyword_table[index];\n')
+        f.write('    if(keyword->length == length && !memcmp(keyword->name, s, length)) {\n')
+        f.write('        return keyword;\n')
+        f.write('    }\n')
+        f.write('    return NULL;\n')
+        f.write('}\n')
+
+
+if __name__ == '__main__':
+
+    if len(sys.argv) != 2:
+        print(f'usage: {sys.argv[0]} header_file', file=sys.stderr)
+        exit(1)
+
+    first_shift, last_shift, mod = bruteforce()
+    print(f'keywords: {len(keywords)}, table size: {mod}, shifts: {first_shift}, {last_shift}', file=sys.stderr)
+
+    print('Generating files...')
+    output_header(sys.argv[1], first_shift, last_shift, mod)
@@ -0,0 +1,59 @@
+##
+# @file build_pow5.py
+# @author xkrato61 Pavel Kratochvil
+#
+# @brief generate the table of 128-bit powers of five used to parse decimal literals
+#
+
+import sys
+
+# range of decimal exponents, anything outside rounds to zero or infinity
+MIN_EXPONENT = -342
+MAX_EXPONENT = 308
+
+
+def pow5(q: int) -> int:
+    # 5^q normalized so that bit 127 is set, truncated to 128 bits, negative powers rounded up
+    if q >= 0:
+        power5 = 5 ** q
+        while power5 < (1 << 127):
+            power5 *= 2
+        while power5 >= (1 << 128):
+            power5 //= 2
+        return power5
+
+    power5 = 5 ** -q
+    z = 0
+    while (1 << z) < power5:
+        z += 1
+    if q >= -27:
+        return 2 ** (z + 127) // power5 + 1
+    c = 2 ** (2 * z + 2 * 64) // power5 + 1
+    while c >= (1 << 128):
+        c //= 2
+    return c
+
+
+def output_header(header_fname: str):
+    with open(header_fname, 'w') as f:
+        f.write(f'/*\n * This file was generated by {sys.argv[0]}, DO NOT MODIFY!\n */\n')
+        f.write('#pragma once\n\n')
+        f.write('#include <stdint.h>\n\n')
+        f.write(f'#define POW5_MIN_EXPONENT ({MIN_EXPONENT})\n')
+        f.write(f'#define POW5_MAX_EXPONENT ({MAX_EXPONENT})\n\n')
+        f.write('/// 5^q for q from POW5_MIN_EXPONENT, as high and low 64 bits of a normalized 128-bit value\n')
+        f.write(f'static const uint64_t pow5_table[{MAX_EXPONENT - MIN_EXPONENT + 1}][2] = {{\n')
+        for q in range(MIN_EXPONENT, MAX_EXPONENT + 1):
+            c = pow5(q)
+            f.write(f'    {{ 0x{c >> 64:016x}, 0x{c & ((1 << 64) - 1):016x} }},\n')
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+
+    if len(sys.argv) != 2:
+        print(f'usage: {sys.argv[0]} header_file', file=sys.stderr)
+        exit(1)
+
+    print('Generating files...')
+    output_header(sys.argv[1])
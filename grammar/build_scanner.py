@@ -0,0 +1,354 @@
+##
+# @file build_scanner.py
+# @author xkrato61 Pavel Kratochvil
+#
+# @brief generate the scanner DFA (character classes and transition table) from its specification
+#
+
+from typing import Dict, List, Optional, Tuple
+import sys
+
+# character classes, every byte belongs to exactly one class, EOF has its own
+char_classes: List[Tuple[str, str]] = [
+    ('OTHER', ''),
+    ('EOF', ''),
+    ('SPACE', ' \t\v\f\r'),
+    ('NEWLINE', '\n'),
+    ('DIGIT', '0123456789'),
+    ('LETTER', 'ABCDFGHIJKLMNOPQRSTUVWXYZabcdfghijklmopqrsuvwxyz_'),
+    ('E', 'eE'),
+    ('N', 'n'),
+    ('T', 't'),
+    ('LT', '<'),
+    ('GT', '>'),
+    ('DOT', '.'),
+    ('EQUALS', '='),
+    ('TILDE', '~'),
+    ('PERCENT', '%'),
+    ('CARET', '^'),
+    ('PLUS', '+'),
+    ('ASTERISK', '*'),
+    ('LPAREN', '('),
+    ('RPAREN', ')'),
+    ('COLON', ':'),
+    ('COMMA', ','),
+    ('HASH', '#'),
+    ('SLASH', '/'),
+    ('MINUS', '-'),
+    ('QUOTE', '"'),
+    ('BACKSLASH', '\\'),
+    ('LBRACKET', '['),
+    ('RBRACKET', ']'),
+]
+
+IDENTIFIER = ['LETTER', 'E', 'N', 'T', 'DIGIT']
+
+# states in the order of the scanner_state enum, with their doc comments
+states: List[Tuple[str, str]] = [
+    ('START', 'Starting state, where scanner returns after every token'),
+    ('KEYWORD_IDENTIFIER', 'State for a possible identifier or reserved keyword'),
+    ('NUMBER', 'State for reading integer digits'),
+    ('DECIMAL', 'State for decimal digits'),
+    ('EXPONENT', 'State for "e" or "E"'),
+    ('EXPONENT_VALUE', 'State for exponent value, ONLY integer exponent value is accepted'),
+    ('COMMENT_DASH_1', 'State for the first dash at the beginning of commentary'),
+    ('COMMENT_DASH_2', 'State for the second dash at the beginning of commentary'),
+    ('INLINE_COMMENT', 'State for insides of inline comment to ignore'),
+    ('BLOCK_COMMENT_BRACKET', 'State for the first square opening bracket'),
+    ('BLOCK_COMMENT', 'State for insides of block comment to ignore'),
+    ('CLOSING_BRACKET', 'State for the first closing bracket of block comment'),
+    ('STRING', 'State for reading string'),
+    ('ESCAPE_CHAR_SEQ', 'State for reading escape character or first digit from escape decimal sequence'),
+    ('ESCAPE_SEQ_1', 'State for reading second digit from escape decimal sequence'),
+    ('ESCAPE_SEQ_2', 'State for reading third digit from escape decimal sequence'),
+    ('DOT', 'State for the first \'.\' at the beginning of \'..\' operator'),
+    ('LESS_THAN', 'State for \'<\' at the beginning of \'<=\' operator'),
+    ('GREATER_THAN', 'State for \'>\' at the beginning of \'>=\' operator'),
+    ('EQUALS', 'State for the first \'=\' at the beginning of \'==\' operator'),
+    ('TILDE', 'State for \'~\' at the beginning of \'~=\' operator'),
+    ('SLASH', 'State for \'/\' at the beginning of \'//\' operator'),
+]
+
+# actions executed by the scanner loop after taking a transition
+actions: List[Tuple[str, str]] = [
+    ('NONE', 'only change state'),
+    ('EMIT', 'return token of type token'),
+    ('ERROR', 'return lexical error'),
+    ('INTEGER', 'return integer from lexeme'),
+    ('DECIMAL', 'return number from lexeme'),
+    ('IDENTIFIER', 'return identifier or keyword from lexeme'),
+    ('STRING_OPEN', 'string lexeme starts after the quote'),
+    ('STRING_CHAR', 'append char if string has been materialized'),
+    ('STRING_CLOSE', 'return string'),
+    ('ESCAPE', 'materialize string read so far, start escape sequence'),
+    ('ESCAPE_CHAR', 'append escaped char'),
+    ('ESCAPE_DIGIT', 'remember digit of decimal escape sequence'),
+    ('ESCAPE_CODE', 'append char of decimal escape sequence'),
+]
+
+# flags applied before the action, in this order
+flags: List[Tuple[str, str]] = [
+    ('MARK', 'token starts here, remember its position'),
+    ('UNREAD', 'char doesn\'t belong to the token, return it to the source'),
+    ('SKIP', 'next state has a fast path, skip chars it would ignore'),
+]
+
+# states with a vectorized skip routine in scanner.c, entered only by transitions that don't return
+skip_states = ['START', 'INLINE_COMMENT', 'BLOCK_COMMENT', 'STRING']
+skip_actions = ['NONE', 'STRING_OPEN', 'STRING_CHAR', 'ESCAPE_CHAR', 'ESCAPE_CODE']
+
+
+class Transition:
+    def __init__(self, next_state: str, action: str = 'NONE', token: Optional[str] = None,
+                 flags: Tuple[str, ...] = ()):
+        self.next_state = next_state
+        self.action = action
+        self.token = token
+        self.flags = flags
+
+
+def emit(token: str, *flags: str) -> Transition:
+    return Transition('START', 'EMIT', token, flags)
+
+
+# state -> (default transition, {class: transition})
+Spec = Dict[str, Tuple[Transition, Dict[str, Transition]]]
+
+spec: Spec = {
+    'START': (
+        Transition('START', 'ERROR'),
+        {
+            'SPACE': Transition('START'),
+            'NEWLINE': Transition('START'),
+            'DIGIT': Transition('NUMBER'),
+            **{cls: Transition('KEYWORD_IDENTIFIER') for cls in ['LETTER', 'E', 'N', 'T']},
+            'LT': Transition('LESS_THAN'),
+            'GT': Transition('GREATER_THAN'),
+            'DOT': Transition('DOT'),
+            'EQUALS': Transition('EQUALS'),
+            'TILDE': Transition('TILDE'),
+            'SLASH': Transition('SLASH'),
+            'MINUS': Transition('COMMENT_DASH_1'),
+            'QUOTE': Transition('STRING', 'STRING_OPEN'),
+            'PERCENT': emit('T_PERCENT'),
+            'CARET': emit('T_CARET'),
+            'PLUS': emit('T_PLUS'),
+            'ASTERISK': emit('T_ASTERISK'),
+            'LPAREN': emit('T_LPAREN'),
+            'RPAREN': emit('T_RPAREN'),
+            'COLON': emit('T_COLON'),
+            'COMMA': emit('T_COMMA'),
+            'HASH': emit('T_HASH'),
+            'EOF': emit('T_EOF'),
+        },
+    ),
+    'KEYWORD_IDENTIFIER': (
+        Transition('START', 'IDENTIFIER', flags=('UNREAD',)),
+        {cls: Transition('KEYWORD_IDENTIFIER') for cls in IDENTIFIER},
+    ),
+    'NUMBER': (
+        Transition('START', 'INTEGER', flags=('UNREAD',)),
+        {
+            'DIGIT': Transition('NUMBER'),
+            'DOT': Transition('DECIMAL'),
+            'E': Transition('EXPONENT'),
+        },
+    ),
+    'DECIMAL': (
+        Transition('START', 'DECIMAL', flags=('UNREAD',)),
+        {
+            'DIGIT': Transition('DECIMAL'),
+            'E': Transition('EXPONENT'),
+        },
+    ),
+    'EXPONENT': (
+        Transition('START', 'ERROR'),
+        {cls: Transition('EXPONENT_VALUE') for cls in ['PLUS', 'MINUS', 'DIGIT']},
+    ),
+    'EXPONENT_VALUE': (
+        Transition('START', 'DECIMAL', flags=('UNREAD',)),
+        {'DIGIT': Transition('EXPONENT_VALUE')},
+    ),
+    'DOT': (
+        Transition('START', 'ERROR'),
+        {'DOT': emit('T_DOUBLE_DOT')},
+    ),
+    'LESS_THAN': (
+        emit('T_LT', 'UNREAD'),
+        {'EQUALS': emit('T_LTE')},
+    ),
+    'GREATER_THAN': (
+        emit('T_GT', 'UNREAD'),
+        {'EQUALS': emit('T_GTE')},
+    ),
+    'EQUALS': (
+        emit('T_EQUALS', 'UNREAD'),
+        {'EQUALS': emit('T_DOUBLE_EQUALS')},
+    ),
+    'TILDE': (
+        Transition('START', 'ERROR', flags=('UNREAD',)),
+        {'EQUALS': emit('T_TILDE_EQUALS')},
+    ),
+    'SLASH': (
+        emit('T_SLASH', 'UNREAD'),
+        {'SLASH': emit('T_DOUBLE_SLASH')},
+    ),
+    'COMMENT_DASH_1': (
+        emit('T_MINUS', 'UNREAD'),
+        {'MINUS': Transition('COMMENT_DASH_2')},
+    ),
+    'COMMENT_DASH_2': (
+        Transition('INLINE_COMMENT'),
+        {'LBRACKET': Transition('BLOCK_COMMENT_BRACKET')},
+    ),
+    'INLINE_COMMENT': (
+        Transition('INLINE_COMMENT'),
+        {
+            'NEWLINE': Transition('START'),
+            'EOF': Transition('INLINE_COMMENT', 'ERROR'),
+        },
+    ),
+    'BLOCK_COMMENT_BRACKET': (
+        Transition('INLINE_COMMENT'),
+        {'LBRACKET': Transition('BLOCK_COMMENT')},
+    ),
+    'BLOCK_COMMENT': (
+        Transition('BLOCK_COMMENT'),
+        {
+            'RBRACKET': Transition('CLOSING_BRACKET'),
+            'EOF': Transition('BLOCK_COMMENT', 'ERROR'),
+        },
+    ),
+    'CLOSING_BRACKET': (
+        Transition('CLOSING_BRACKET'),
+        {
+            'RBRACKET': Transition('START'),
+            'EOF': Transition('CLOSING_BRACKET', 'ERROR'),
+        },
+    ),
+    'STRING': (
+        Transition('STRING', 'STRING_CHAR'),
+        {
+            'BACKSLASH': Transition('ESCAPE_CHAR_SEQ', 'ESCAPE'),
+            'QUOTE': Transition('START', 'STRING_CLOSE'),
+            'EOF': Transition('STRING', 'ERROR'),
+        },
+    ),
+    'ESCAPE_CHAR_SEQ': (
+        Transition('START', 'ERROR'),
+        {
+            **{cls: Transition('STRING', 'ESCAPE_CHAR') for cls in ['BACKSLASH', 'N', 'T', 'QUOTE']},
+            'DIGIT': Transition('ESCAPE_SEQ_1', 'ESCAPE_DIGIT'),
+        },
+    ),
+    'ESCAPE_SEQ_1': (
+        Transition('START', 'ERROR'),
+        {'DIGIT': Transition('ESCAPE_SEQ_2', 'ESCAPE_DIGIT')},
+    ),
+    'ESCAPE_SEQ_2': (
+        Transition('ESCAPE_SEQ_2'),
+        {
+            'DIGIT': Transition('STRING', 'ESCAPE_CODE'),
+            'EOF': Transition('START', 'ERROR'),
+        },
+    ),
+}
+
+
+def build_table() -> List[List[Transition]]:
+    class_names = [name for name, _ in char_classes]
+    state_names = [name for name, _ in states]
+    table = []
+    for state in state_names:
+        default, overrides = spec[state]
+        for cls in overrides:
+            assert cls in class_names, f'unknown class {cls} in state {state}'
+        row = []
+        for cls in class_names:
+            transition = overrides.get(cls, default)
+            assert transition.next_state in state_names, f'unknown state {transition.next_state}'
+            flags = transition.flags
+            if state == 'START':
+                # every char read in the starting state may begin a token
+                flags = ('MARK',) + flags
+            if transition.next_state in skip_states and transition.action in skip_actions:
+                flags = flags + ('SKIP',)
+            row.append(Transition(transition.next_state, transition.action, transition.token, flags))
+        table.append(row)
+    return table
+
+
+def class_of_bytes() -> List[str]:
+    classes = ['OTHER'] * 256
+    for name, chars in char_classes:
+        for ch in chars:
+            assert classes[ord(ch)] == 'OTHER', f'{ch!r} is in more than one class'
+            classes[ord(ch)] = name
+    return classes
+
+
+def output_header(header_fname: str):
+    table = build_table()
+    classes = class_of_bytes()
+    state_width = max(len(name) for name, _ in states) + len('SCANNER_STATE_') + 1
+
+    with open(header_fname, 'w') as f:
+        f.write(f'/*\n * This file was generated by {sys.argv[0]}, DO NOT MODIFY!\n */\n')
+        f.write('#pragma once\n\n')
+        f.write('#include <stdint.h>\n\n')
+        f.write('#include "parser-generated.h"\n\n')
+
+        f.write('typedef enum\n{\n')
+        for name, doc in states:
+            f.write(f'    {"SCANNER_STATE_" + name + ",":<{state_width}} ///< {doc}\n')
+        f.write('    SCANNER_STATE_COUNT\n')
+        f.write('} scanner_state;\n\n')
+
+        f.write('typedef enum\n{\n')
+        for name, chars in char_classes:
+            f.write(f'    CHAR_CLASS_{name},\n')
+        f.write('    CHAR_CLASS_COUNT\n')
+        f.write('} char_class_t;\n\n')
+
+        f.write('typedef enum\n{\n')
+        for name, doc in actions:
+            f.write(f'    SCANNER_ACTION_{name}, ///< {doc}\n')
+        f.write('} scanner_action_t;\n\n')
+
+        for i, (name, doc) in enumerate(flags):
+            f.write(f'#define SCANNER_FLAG_{name} ({1 << i}) ///< {doc}\n')
+        f.write('\n')
+
+        f.write('typedef struct {\n')
+        f.write('    uint8_t next;   ///< next scanner_state\n')
+        f.write('    uint8_t action; ///< scanner_action_t executed after flags\n')
+        f.write('    uint8_t flags;  ///< SCANNER_FLAG_* bits\n')
+        f.write('    uint8_t token;  ///< term_type_t returned by SCANNER_ACTION_EMIT\n')
+        f.write('} scanner_transition_t;\n\n')
+
+        f.write('static const uint8_t scanner_char_class[256] = {\n')
+        for row in range(0, 256, 8):
+            f.write('    ' + ' '.join(f'CHAR_CLASS_{cls},' for cls in classes[row:row + 8]) + '\n')
+        f.write('};\n\n')
+
+        f.write('static const scanner_transition_t scanner_transitions[SCANNER_STATE_COUNT]'
+                '[CHAR_CLASS_COUNT] = {\n')
+        for (state, _), row in zip(states, table):
+            f.write(f'    [SCANNER_STATE_{state}] = {{\n')
+            for (cls, _), t in zip(char_classes, row):
+                flag_expr = ' | '.join(f'SCANNER_FLAG_{flag}' for flag in t.flags) or '0'
+                token = t.token or '0'
+                f.write(f'        [CHAR_CLASS_{cls}] = {{ SCANNER_STATE_{t.next_state}, '
+                        f'SCANNER_ACTION_{t.action}, {flag_expr}, {token} }},\n')
+            f.write('    },\n')
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+
+    if len(sys.argv) != 2:
+        print(f'usage: {sys.argv[0]} header_file', file=sys.stderr)
+        exit(1)
+
+    print('Generating files...')
+    output_header(sys.argv[1])
@@ -0,0 +1,47 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file arena.h
+ *
+ * @brief Bump allocator, everything allocated from an arena is released at once
+ */
+#pragma once
+
+#include <stddef.h>
+
+typedef struct arena_chunk arena_chunk_t;
+
+/**
+ * @brief Arena structure, zero initialized arena is empty and ready to use
+ */
+typedef struct {
+    arena_chunk_t *chunks; ///< list of chunks, the newest one is being filled
+    char *cursor;          ///< next free byte in the newest chunk
+    char *end;             ///< end of the newest chunk
+    size_t chunk_size;     ///< size of the next chunk, grows geometrically
+} arena_t;
+
+/**
+ * @brief Allocates zeroed memory from arena
+ *
+ * Memory is aligned for any basic type and stays valid until arena_free.
+ *
+ * @param arena pointer to arena
+ * @param size size in bytes
+ * @return pointer to memory, NULL on allocation error
+ */
+void *arena_alloc(arena_t *arena, size_t size);
+
+/**
+ * @brief Releases all memory allocated from arena, arena stays usable
+ *
+ * @param arena pointer to arena
+ */
+void arena_free(arena_t *arena);
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "atom.h"
 #include "dynstring.h"
 #include "type.h"
 
@@ -90,19 +91,20 @@ typedef struct ast_node ast_node_t;
 typedef ast_node_t *ast_node_list_t;
 
 typedef struct symbol symbol_t;
+// fields are ordered by size to keep symbol nodes small
 struct symbol {
     bool is_declaration;
-    symbol_t *last_assignment;
     int current_read;
+    symbol_t *last_assignment;
     union {
         struct {
+            atom_t name;
+            ast_node_t *expr;
             type_t type;
-            string_t name;
+            int read_count;
             bool used;
             bool dirty;
             bool constant;
-            ast_node_t *expr;
-            int read_count;
             //            union {
             //                string_t string;
             //                int64_t integer;
@@ -118,9 +120,17 @@ typedef struct {
     type_t result;
 } ast_metadata_t;
 
+/**
+ * @brief String owned by the AST, null terminated and never modified after creation
+ */
+typedef struct {
+    char *ptr;     ///< chars in AST memory
+    size_t length; ///< number of chars
+} ast_string_t;
+
 // declarations of different ast_node types
 typedef struct {
-    string_t require;
+    ast_string_t require;
     ast_node_list_t global_statement_list;
 } ast_program_t;
 
@@ -131,7 +141,7 @@ typedef struct {
 typedef struct ast_func_def ast_func_def_t;
 
 typedef struct {
-    string_t name;
+    atom_t name;
     ast_node_list_t argument_types;
     ast_node_list_t return_types;
     ast_func_def_t *def;
@@ -139,7 +149,7 @@ typedef struct {
 } ast_func_decl_t;
 
 struct ast_func_def {
-    string_t name;
+    atom_t name;
     ast_node_list_t arguments;
     ast_node_list_t return_types;
     ast_node_t *body;
@@ -181,7 +191,7 @@ typedef struct {
 } ast_assignment_t;
 
 typedef struct {
-    string_t name;
+    atom_t name;
     ast_node_list_t arguments;
     ast_func_def_t *def;
     ast_func_decl_t *decl;
@@ -205,8 +215,17 @@ typedef struct {
     ast_func_def_t *def;
 } ast_return_t;
 
+/**
+ * @brief AST node
+ *
+ * Nodes are allocated by ast_alloc_node at the size of their kind, only the union member
+ * matching node_type may be accessed and a node can only be turned into a kind of the same
+ * or smaller size.
+ */
 struct ast_node {
     ast_node_type_t node_type;
+    int visited_children;
+    ast_node_t *next;
     union {
         ast_program_t program;
 
@@ -231,9 +250,38 @@ struct ast_node {
         int64_t integer;
         double number;
         bool boolean;
-        string_t string;
+        ast_string_t string;
         type_t type;
-    };
-    ast_node_t *next;
-    int visited_children;
+    }; // has to be the last member
 };
+
+/**
+ * @brief Allocates zeroed memory owned by the AST of the compilation unit
+ *
+ * @param size size in bytes
+ * @return pointer to memory, NULL on allocation error
+ */
+void *ast_alloc(size_t size);
+
+/**
+ * @brief Allocates zeroed AST node of given kind at the size of its union member
+ *
+ * @param type node kind
+ * @return pointer to node with node_type set, NULL on allocation error
+ */
+ast_node_t *ast_alloc_node(ast_node_type_t type);
+
+/**
+ * @brief Copies chars into a string owned by the AST
+ *
+ * @param s chars to copy, don't have to be null terminated
+ * @param length number of chars
+ * @param str output string
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+int ast_alloc_string(const char *s, size_t length, ast_string_t *str);
+
+/**
+ * @brief Releases all nodes and strings of the AST at once
+ */
+void ast_free();
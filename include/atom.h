@@ -0,0 +1,97 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file atom.h
+ *
+ * @brief Identifier interning table
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Interned identifier, every distinct string is stored exactly once
+ */
+struct atom {
+    uint64_t hash; ///< cached hash of str
+    size_t length; ///< length of str
+    char str[];    ///< null terminated identifier
+};
+
+/**
+ * @brief Stable handle of an interned identifier, equal strings have equal atoms
+ */
+typedef const struct atom *atom_t;
+
+/**
+ * @brief Interns a char sequence
+ *
+ * @param s char sequence, doesn't have to be null terminated
+ * @param length length of s
+ * @return atom of s, NULL on allocation error
+ */
+atom_t atom_intern(const char *s, size_t length);
+
+/**
+ * @brief Interns a null terminated string
+ *
+ * @param s string to intern
+ * @return atom of s, NULL on allocation error
+ */
+atom_t atom_intern_cstr(const char *s);
+
+/**
+ * @brief Finds atom of a char sequence without interning it
+ *
+ * @param s char sequence, doesn't have to be null terminated
+ * @param length length of s
+ * @return atom of s, NULL if s was never interned
+ */
+atom_t atom_find(const char *s, size_t length);
+
+/**
+ * @brief Finds atom of a null terminated string without interning it
+ *
+ * @param s string to find
+ * @return atom of s, NULL if s was never interned
+ */
+atom_t atom_find_cstr(const char *s);
+
+/**
+ * @brief Interns an atom followed by a suffix
+ *
+ * @param atom prefix
+ * @param suffix null terminated suffix
+ * @return atom of concatenated string, NULL on allocation error
+ */
+atom_t atom_concat(atom_t atom, const char *suffix);
+
+/**
+ * @brief Returns the cached hash of atom, for typed hashtables keyed by atom
+ */
+static inline uint64_t atom_hash(atom_t atom)
+{
+    return atom->hash;
+}
+
+/**
+ * @brief Compares atoms, interning makes equal strings the same atom
+ */
+static inline bool atom_equal(atom_t a, atom_t b)
+{
+    return a == b;
+}
+
+/**
+ * @brief Frees all atoms, previously returned atoms become invalid
+ */
+void atom_table_free(void);
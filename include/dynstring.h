@@ -15,19 +15,34 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 
-/// pre-allocate this many bytes when creating an empty string
-#define STRING_ALLOC_LENGTH 16
+/// strings shorter than this are stored inline, without allocating
+#define STRING_SMALL_LENGTH 16
 
 /**
  * @brief string type definition
+ *
+ * Short strings live in the small buffer and ptr points there, such a string must not be moved
+ * while in use. alloc_length tells where the buffer is: 0 if borrowed, STRING_SMALL_LENGTH if
+ * inline, more if on the heap and owned. Copies of the struct only borrow the buffer of the
+ * original, copies of short strings are safe to free, copies of long ones aren't.
  */
 typedef struct {
-    char *ptr;           ///< pointer to actual string data, null terminated
-    size_t alloc_length; ///< size allocated in bytes
-    size_t length;       ///< length of the actual string
+    char *ptr;                       ///< pointer to actual string data, null terminated
+    size_t alloc_length;             ///< size of the buffer in bytes, 0 if borrowed
+    size_t length;                   ///< length of the actual string
+    char small[STRING_SMALL_LENGTH]; ///< inline buffer for short strings
 } string_t;
 
+/**
+ * @brief non-owning view of a char sequence, not null terminated
+ */
+typedef struct {
+    const char *ptr; ///< pointer to the first char
+    size_t length;   ///< number of chars in view
+} str_view_t;
+
 /**
  * @brief Creates an empty string object
  *
@@ -45,6 +60,15 @@ int str_create_empty(string_t *str);
  */
 int str_create(const char *s, string_t *str);
 
+/**
+ * @brief Creates a string object and loads it with contents of a view
+ *
+ * @param view char sequence to load
+ * @param[out] str pointer to newly created string
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_create_view(str_view_t view, string_t *str);
+
 /**
  * @brief Appends a char to the string object
  *
@@ -54,9 +78,88 @@ int str_create(const char *s, string_t *str);
  */
 int str_append_char(string_t *str, char ch);
 
+/**
+ * @brief Appends a char sequence to the string object
+ *
+ * @param str string object to append the chars to
+ * @param view chars that get appended
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_append_view(string_t *str, str_view_t view);
+
+/**
+ * @brief Makes room for a string of given length, so that appends up to it don't reallocate
+ *
+ * A borrowed buffer is copied to a new one owned by the string.
+ *
+ * @param str string object to grow
+ * @param length number of chars the string has to fit, without the null byte
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_reserve(string_t *str, size_t length);
+
+/**
+ * @brief Appends a null terminated char sequence to the string object
+ *
+ * @param str string object to append the chars to
+ * @param s chars that get appended
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_append_cstr(string_t *str, const char *s);
+
+/**
+ * @brief Appends contents of another string object
+ *
+ * @param str string object to append to
+ * @param other string whose contents get appended, has to be a different object
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_append_str(string_t *str, const string_t *other);
+
+/**
+ * @brief Appends decimal representation of an integer
+ *
+ * @param str string object to append to
+ * @param value integer to format
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_append_int(string_t *str, int64_t value);
+
+/**
+ * @brief Appends hexadecimal representation of a double, as printed by "%a"
+ *
+ * The representation is exact, it's what IFJcode21 float literals use.
+ *
+ * @param str string object to append to
+ * @param value double to format
+ * @return E_INT on allocation error, else E_OK
+ */
+int str_append_float(string_t *str, double value);
+
+/**
+ * @brief Takes the contents out of a string object
+ *
+ * Inline contents are copied to the heap, so the result outlives the string object.
+ *
+ * @param str string object, it is left empty and doesn't have to be freed
+ * @return heap allocated null terminated contents owned by the caller, NULL on allocation error
+ */
+char *str_detach(string_t *str);
+
 /**
  * @brief Frees memory allocated by a string object
  *
+ * Only heap buffers are freed, inline and borrowed ones are left alone.
+ *
  * @param str string to free
  */
 void str_free(string_t *str);
+
+/**
+ * @brief Compares a view with a null terminated char sequence
+ *
+ * @param view view to compare
+ * @param s char sequence to compare with
+ * @return 0 if equal, negative if view orders first, otherwise positive
+ */
+int str_view_cmp(str_view_t view, const char *s);
@@ -0,0 +1,59 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file hash.h
+ *
+ * @brief String hash functions
+ *
+ * Every function hashes a char sequence of given length. HASH_DEFAULT picks
+ * the one used for atoms and thereby for every table keyed by them, another
+ * one can be selected at build time, e.g. with -DHASH_DEFAULT=hash_wy.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef HASH_DEFAULT
+#define HASH_DEFAULT hash_fnv1a
+#endif
+
+/**
+ * @brief Hash function of a char sequence
+ */
+typedef uint64_t (*hash_bytes_t)(const char *s, size_t length);
+
+/**
+ * @brief FNV-1a, one multiplication per char
+ *
+ * @param s char sequence, doesn't have to be null terminated
+ * @param length length of s
+ * @return hash of s
+ */
+uint64_t hash_fnv1a(const char *s, size_t length);
+
+/**
+ * @brief wyhash style hash, mixes 16 bytes per step by 64x64->128 bit multiplications
+ *
+ * @param s char sequence, doesn't have to be null terminated
+ * @param length length of s
+ * @return hash of s
+ */
+uint64_t hash_wy(const char *s, size_t length);
+
+/**
+ * @brief Multiply-mix over four independent 64 bit lanes, which vectorize
+ *
+ * @param s char sequence, doesn't have to be null terminated
+ * @param length length of s
+ * @return hash of s
+ */
+uint64_t hash_mix(const char *s, size_t length);
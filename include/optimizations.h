@@ -15,7 +15,6 @@
 #pragma once
 
 #include "semantics.h"
-#include "hashtable_bst.h"
 
 extern bool optimus_prime;
 
@@ -40,8 +39,6 @@ int optimize_ast(ast_node_t *node);
 
 bool is_function_used(ast_func_def_t *def);
 
-int gen_usage(ast_node_t *node, hashtable_t *map);
-
 bool gen_is_used(int index);
 
 bool is_not_nil(ast_node_t *node);
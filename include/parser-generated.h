@@ -25,6 +25,9 @@
 #include "type.h"
 #include "dynstring.h"
 
+#define NTERM_COUNT 42
+#define TERM_COUNT 47
+
 // order of these two enums is crucial
 typedef enum
 {
@@ -133,21 +136,15 @@ typedef struct {
 } nut_type_t;
 
 typedef struct {
-    size_t size;
-    nut_type_t *data;
-    bool valid;
+    uint16_t offset; ///< index of the first nut in parser_rules
+    uint8_t size;    ///< number of nuts, zero for epsilon
+    bool valid;      ///< false if there is no expansion
 } exp_list_t;
 
-// hashmap without collisions
-typedef struct {
-    size_t bucket_count;
-    exp_list_t data[];
-} parser_table_t;
-
-size_t parser_get_table_index(nterm_type_t nterm, term_type_t term);
 const char *nterm_to_readable(nterm_type_t nterm);
 const char *term_to_readable(term_type_t term);
-int parser_init();
-void parser_free();
 
-extern parser_table_t *table;
+/// right sides of all expansions
+extern const nut_type_t parser_rules[171];
+/// LL table indexed by the expanded nterm and the following term
+extern const exp_list_t parser_table[NTERM_COUNT][TERM_COUNT];
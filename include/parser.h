@@ -32,12 +32,6 @@ int parse(nterm_type_t nterm, ast_node_t **root, int depth);
  */
 int precedence_parse(ast_node_t **root);
 
-/**
- * @brief Frees AST from memory
- * @param root AST root
- */
-void free_ast(ast_node_t *root);
-
 /**
  * @brief Prints AST to stdout
  * @param depth nesting depth
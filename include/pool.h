@@ -0,0 +1,70 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file pool.h
+ *
+ * @brief Fixed size object allocator, objects come from slabs and are recycled by a free list
+ */
+#pragma once
+
+#include <stddef.h>
+
+typedef struct pool_slab pool_slab_t;
+
+/**
+ * @brief Allocator pressure counters
+ */
+typedef struct {
+    size_t live;  ///< objects allocated and not released
+    size_t peak;  ///< maximum of live
+    size_t slabs; ///< slabs allocated
+} pool_stats_t;
+
+/**
+ * @brief Pool structure, pool with only object_size set is empty and ready to use
+ *
+ * Pools aren't thread safe.
+ */
+typedef struct {
+    size_t object_size;  ///< size of one object
+    pool_slab_t *slabs;  ///< list of slabs, the newest one is being carved
+    void *free_list;     ///< released objects, linked through their first bytes
+    char *cursor;        ///< next never used object in the newest slab
+    char *end;           ///< end of the newest slab
+    size_t slab_objects; ///< number of objects in the next slab, grows geometrically
+    pool_stats_t stats;  ///< allocator pressure counters
+} pool_t;
+
+/**
+ * @brief Allocates an object from pool
+ *
+ * Memory is aligned for any basic type and isn't initialized.
+ *
+ * @param pool pointer to pool
+ * @return pointer to object, NULL on allocation error
+ */
+void *pool_alloc(pool_t *pool);
+
+/**
+ * @brief Returns an object to pool for reuse
+ *
+ * @param pool pool the object was allocated from
+ * @param object pointer to object, NULL is ignored
+ */
+void pool_release(pool_t *pool, void *object);
+
+/**
+ * @brief Frees all slabs, every object of pool becomes invalid
+ *
+ * Counters are reset, object size is kept and pool can be used again.
+ *
+ * @param pool pointer to pool
+ */
+void pool_free(pool_t *pool);
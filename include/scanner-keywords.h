@@ -0,0 +1,97 @@
+/*
+ * This file was generated by build_keywords.py, DO NOT MODIFY!
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "parser-generated.h"
+#include "type.h"
+
+#define KEYWORD_MIN_LENGTH (2)
+#define KEYWORD_MAX_LENGTH (8)
+#define KEYWORD_TABLE_SIZE (49)
+
+typedef struct {
+    const char *name;       ///< keyword, empty slots have length 0
+    uint8_t length;         ///< length of name
+    term_type_t token_type; ///< token type of keyword
+    int value;              ///< type_t for T_TYPE, bool for T_BOOL
+} keyword_t;
+
+static const keyword_t keyword_table[KEYWORD_TABLE_SIZE] = {
+    { "global", 6, T_GLOBAL, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "local", 5, T_LOCAL, 0 },
+    { "end", 3, T_END, 0 },
+    { "then", 4, T_THEN, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "boolean", 7, T_TYPE, TYPE_BOOL },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "else", 4, T_ELSE, 0 },
+    { "require", 7, T_REQUIRE, 0 },
+    { "while", 5, T_WHILE, 0 },
+    { "nil", 3, T_NIL, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "elseif", 6, T_ELSEIF, 0 },
+    { "or", 2, T_OR, 0 },
+    { "do", 2, T_DO, 0 },
+    { "true", 4, T_BOOL, true },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "repeat", 6, T_REPEAT, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "until", 5, T_UNTIL, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "function", 8, T_FUNCTION, 0 },
+    { "and", 3, T_AND, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "if", 2, T_IF, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "integer", 7, T_TYPE, TYPE_INTEGER },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "number", 6, T_TYPE, TYPE_NUMBER },
+    { "false", 5, T_BOOL, false },
+    { "for", 3, T_FOR, 0 },
+    { "break", 5, T_BREAK, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "not", 3, T_NOT, 0 },
+    { "return", 6, T_RETURN, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "string", 6, T_TYPE, TYPE_STRING },
+    { "", 0, T_IDENTIFIER, 0 },
+    { "", 0, T_IDENTIFIER, 0 },
+};
+
+/**
+ * @brief Looks up a reserved keyword using one hash and one memcmp
+ *
+ * @param s identifier, doesn't have to be null terminated
+ * @param length length of identifier
+ * @return keyword entry or NULL if s isn't a keyword
+ */
+static inline const keyword_t *keyword_lookup(const char *s, size_t length)
+{
+    if(length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH) {
+        return NULL;
+    }
+    size_t index = (((size_t)(unsigned char) s[0] << 7) +
+                    ((size_t)(unsigned char) s[length - 1] << 2) + length) %
+                   KEYWORD_TABLE_SIZE;
+    const keyword_t *keyword = &keyword_table[index];
+    if(keyword->length == length && !memcmp(keyword->name, s, length)) {
+        return keyword;
+    }
+    return NULL;
+}
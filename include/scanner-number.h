@@ -0,0 +1,40 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file scanner-number.h
+ *
+ * @brief Conversion of number lexemes straight from the source buffer
+ *
+ * Decimals are rounded exactly like strtod() would round them, using the Eisel-Lemire algorithm
+ * and falling back to strtod() when it can't decide.
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Parses decimal digits to integer
+ *
+ * @param p first digit
+ * @param end end of the lexeme
+ * @param[out] value parsed integer
+ * @return 0 on success, 1 if the integer doesn't fit int64_t or a char isn't a digit
+ */
+int parse_integer(const char *p, const char *end, int64_t *value);
+
+/**
+ * @brief Parses number lexeme in the form digits[.digits][(e|E)[+|-]digits] to double
+ *
+ * @param p first char of the lexeme
+ * @param end end of the lexeme
+ * @param[out] value parsed number, correctly rounded
+ * @return 0 on success, 1 on malformed lexeme or allocation error
+ */
+int parse_decimal(const char *p, const char *end, double *value);
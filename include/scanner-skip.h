@@ -0,0 +1,38 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file scanner-skip.h
+ *
+ * @brief Vectorized skipping of whitespace, comment and string bodies
+ *
+ * Uses AVX2 or SSE2 when the compiler targets them, otherwise falls back to a scalar loop.
+ */
+#pragma once
+
+/**
+ * @brief Skips whitespace, that is ' ', '\\t', '\\n', '\\v', '\\f' and '\\r'
+ *
+ * @param p first char to examine
+ * @param end end of the buffer
+ * @return pointer to the first char that isn't whitespace, end if there is none
+ */
+const char *skip_spaces(const char *p, const char *end);
+
+/**
+ * @brief Skips chars until one of three stop chars, which may repeat
+ *
+ * @param p first char to examine
+ * @param end end of the buffer
+ * @param a stop char
+ * @param b stop char
+ * @param c stop char
+ * @return pointer to the first stop char, end if there is none
+ */
+const char *skip_to_any(const char *p, const char *end, char a, char b, char c);
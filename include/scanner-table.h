@@ -0,0 +1,817 @@
+/*
+ * This file was generated by build_scanner.py, DO NOT MODIFY!
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "parser-generated.h"
+
+typedef enum
+{
+    SCANNER_STATE_START,                 ///< Starting state, where scanner returns after every token
+    SCANNER_STATE_KEYWORD_IDENTIFIER,    ///< State for a possible identifier or reserved keyword
+    SCANNER_STATE_NUMBER,                ///< State for reading integer digits
+    SCANNER_STATE_DECIMAL,               ///< State for decimal digits
+    SCANNER_STATE_EXPONENT,              ///< State for "e" or "E"
+    SCANNER_STATE_EXPONENT_VALUE,        ///< State for exponent value, ONLY integer exponent value is accepted
+    SCANNER_STATE_COMMENT_DASH_1,        ///< State for the first dash at the beginning of commentary
+    SCANNER_STATE_COMMENT_DASH_2,        ///< State for the second dash at the beginning of commentary
+    SCANNER_STATE_INLINE_COMMENT,        ///< State for insides of inline comment to ignore
+    SCANNER_STATE_BLOCK_COMMENT_BRACKET, ///< State for the first square opening bracket
+    SCANNER_STATE_BLOCK_COMMENT,         ///< State for insides of block comment to ignore
+    SCANNER_STATE_CLOSING_BRACKET,       ///< State for the first closing bracket of block comment
+    SCANNER_STATE_STRING,                ///< State for reading string
+    SCANNER_STATE_ESCAPE_CHAR_SEQ,       ///< State for reading escape character or first digit from escape decimal sequence
+    SCANNER_STATE_ESCAPE_SEQ_1,          ///< State for reading second digit from escape decimal sequence
+    SCANNER_STATE_ESCAPE_SEQ_2,          ///< State for reading third digit from escape decimal sequence
+    SCANNER_STATE_DOT,                   ///< State for the first '.' at the beginning of '..' operator
+    SCANNER_STATE_LESS_THAN,             ///< State for '<' at the beginning of '<=' operator
+    SCANNER_STATE_GREATER_THAN,          ///< State for '>' at the beginning of '>=' operator
+    SCANNER_STATE_EQUALS,                ///< State for the first '=' at the beginning of '==' operator
+    SCANNER_STATE_TILDE,                 ///< State for '~' at the beginning of '~=' operator
+    SCANNER_STATE_SLASH,                 ///< State for '/' at the beginning of '//' operator
+    SCANNER_STATE_COUNT
+} scanner_state;
+
+typedef enum
+{
+    CHAR_CLASS_OTHER,
+    CHAR_CLASS_EOF,
+    CHAR_CLASS_SPACE,
+    CHAR_CLASS_NEWLINE,
+    CHAR_CLASS_DIGIT,
+    CHAR_CLASS_LETTER,
+    CHAR_CLASS_E,
+    CHAR_CLASS_N,
+    CHAR_CLASS_T,
+    CHAR_CLASS_LT,
+    CHAR_CLASS_GT,
+    CHAR_CLASS_DOT,
+    CHAR_CLASS_EQUALS,
+    CHAR_CLASS_TILDE,
+    CHAR_CLASS_PERCENT,
+    CHAR_CLASS_CARET,
+    CHAR_CLASS_PLUS,
+    CHAR_CLASS_ASTERISK,
+    CHAR_CLASS_LPAREN,
+    CHAR_CLASS_RPAREN,
+    CHAR_CLASS_COLON,
+    CHAR_CLASS_COMMA,
+    CHAR_CLASS_HASH,
+    CHAR_CLASS_SLASH,
+    CHAR_CLASS_MINUS,
+    CHAR_CLASS_QUOTE,
+    CHAR_CLASS_BACKSLASH,
+    CHAR_CLASS_LBRACKET,
+    CHAR_CLASS_RBRACKET,
+    CHAR_CLASS_COUNT
+} char_class_t;
+
+typedef enum
+{
+    SCANNER_ACTION_NONE, ///< only change state
+    SCANNER_ACTION_EMIT, ///< return token of type token
+    SCANNER_ACTION_ERROR, ///< return lexical error
+    SCANNER_ACTION_INTEGER, ///< return integer from lexeme
+    SCANNER_ACTION_DECIMAL, ///< return number from lexeme
+    SCANNER_ACTION_IDENTIFIER, ///< return identifier or keyword from lexeme
+    SCANNER_ACTION_STRING_OPEN, ///< string lexeme starts after the quote
+    SCANNER_ACTION_STRING_CHAR, ///< append char if string has been materialized
+    SCANNER_ACTION_STRING_CLOSE, ///< return string
+    SCANNER_ACTION_ESCAPE, ///< materialize string read so far, start escape sequence
+    SCANNER_ACTION_ESCAPE_CHAR, ///< append escaped char
+    SCANNER_ACTION_ESCAPE_DIGIT, ///< remember digit of decimal escape sequence
+    SCANNER_ACTION_ESCAPE_CODE, ///< append char of decimal escape sequence
+} scanner_action_t;
+
+#define SCANNER_FLAG_MARK (1) ///< token starts here, remember its position
+#define SCANNER_FLAG_UNREAD (2) ///< char doesn't belong to the token, return it to the source
+#define SCANNER_FLAG_SKIP (4) ///< next state has a fast path, skip chars it would ignore
+
+typedef struct {
+    uint8_t next;   ///< next scanner_state
+    uint8_t action; ///< scanner_action_t executed after flags
+    uint8_t flags;  ///< SCANNER_FLAG_* bits
+    uint8_t token;  ///< term_type_t returned by SCANNER_ACTION_EMIT
+} scanner_transition_t;
+
+static const uint8_t scanner_char_class[256] = {
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_SPACE, CHAR_CLASS_NEWLINE, CHAR_CLASS_SPACE, CHAR_CLASS_SPACE, CHAR_CLASS_SPACE, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_SPACE, CHAR_CLASS_OTHER, CHAR_CLASS_QUOTE, CHAR_CLASS_HASH, CHAR_CLASS_OTHER, CHAR_CLASS_PERCENT, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_LPAREN, CHAR_CLASS_RPAREN, CHAR_CLASS_ASTERISK, CHAR_CLASS_PLUS, CHAR_CLASS_COMMA, CHAR_CLASS_MINUS, CHAR_CLASS_DOT, CHAR_CLASS_SLASH,
+    CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT,
+    CHAR_CLASS_DIGIT, CHAR_CLASS_DIGIT, CHAR_CLASS_COLON, CHAR_CLASS_OTHER, CHAR_CLASS_LT, CHAR_CLASS_EQUALS, CHAR_CLASS_GT, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_E, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LBRACKET, CHAR_CLASS_BACKSLASH, CHAR_CLASS_RBRACKET, CHAR_CLASS_CARET, CHAR_CLASS_LETTER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_E, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_N, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_T, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER,
+    CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_LETTER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_TILDE, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+    CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER, CHAR_CLASS_OTHER,
+};
+
+static const scanner_transition_t scanner_transitions[SCANNER_STATE_COUNT][CHAR_CLASS_COUNT] = {
+    [SCANNER_STATE_START] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_EOF },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK | SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK | SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_NUMBER, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_LESS_THAN, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_GREATER_THAN, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_DOT, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_EQUALS, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_TILDE, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_PERCENT },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_CARET },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_PLUS },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_ASTERISK },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_LPAREN },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_RPAREN },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_COLON },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_COMMA },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_MARK, T_HASH },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_SLASH, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_COMMENT_DASH_1, SCANNER_ACTION_NONE, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_OPEN, SCANNER_FLAG_MARK | SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_MARK, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_MARK, 0 },
+    },
+    [SCANNER_STATE_KEYWORD_IDENTIFIER] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_KEYWORD_IDENTIFIER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_IDENTIFIER, SCANNER_FLAG_UNREAD, 0 },
+    },
+    [SCANNER_STATE_NUMBER] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_NUMBER, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_EXPONENT, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_DECIMAL, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_INTEGER, SCANNER_FLAG_UNREAD, 0 },
+    },
+    [SCANNER_STATE_DECIMAL] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_DECIMAL, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_EXPONENT, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+    },
+    [SCANNER_STATE_EXPONENT] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_EXPONENT_VALUE, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_EXPONENT_VALUE, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_EXPONENT_VALUE, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+    },
+    [SCANNER_STATE_EXPONENT_VALUE] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_EXPONENT_VALUE, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_DECIMAL, SCANNER_FLAG_UNREAD, 0 },
+    },
+    [SCANNER_STATE_COMMENT_DASH_1] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_COMMENT_DASH_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_MINUS },
+    },
+    [SCANNER_STATE_COMMENT_DASH_2] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_BLOCK_COMMENT_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+    },
+    [SCANNER_STATE_INLINE_COMMENT] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+    },
+    [SCANNER_STATE_BLOCK_COMMENT_BRACKET] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_INLINE_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+    },
+    [SCANNER_STATE_BLOCK_COMMENT] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_BLOCK_COMMENT, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+    },
+    [SCANNER_STATE_CLOSING_BRACKET] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_CLOSING_BRACKET, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_NONE, SCANNER_FLAG_SKIP, 0 },
+    },
+    [SCANNER_STATE_STRING] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_STRING, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_STRING_CLOSE, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_ESCAPE_CHAR_SEQ, SCANNER_ACTION_ESCAPE, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_STRING, SCANNER_ACTION_STRING_CHAR, SCANNER_FLAG_SKIP, 0 },
+    },
+    [SCANNER_STATE_ESCAPE_CHAR_SEQ] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_ESCAPE_SEQ_1, SCANNER_ACTION_ESCAPE_DIGIT, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_STRING, SCANNER_ACTION_ESCAPE_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_STRING, SCANNER_ACTION_ESCAPE_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_STRING, SCANNER_ACTION_ESCAPE_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_STRING, SCANNER_ACTION_ESCAPE_CHAR, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+    },
+    [SCANNER_STATE_ESCAPE_SEQ_1] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_ESCAPE_DIGIT, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+    },
+    [SCANNER_STATE_ESCAPE_SEQ_2] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_STRING, SCANNER_ACTION_ESCAPE_CODE, SCANNER_FLAG_SKIP, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_ESCAPE_SEQ_2, SCANNER_ACTION_NONE, 0, 0 },
+    },
+    [SCANNER_STATE_DOT] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_DOUBLE_DOT },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, 0, 0 },
+    },
+    [SCANNER_STATE_LESS_THAN] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_LTE },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_LT },
+    },
+    [SCANNER_STATE_GREATER_THAN] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_GTE },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_GT },
+    },
+    [SCANNER_STATE_EQUALS] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_DOUBLE_EQUALS },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_EQUALS },
+    },
+    [SCANNER_STATE_TILDE] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_TILDE_EQUALS },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_ERROR, SCANNER_FLAG_UNREAD, 0 },
+    },
+    [SCANNER_STATE_SLASH] = {
+        [CHAR_CLASS_OTHER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_EOF] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_SPACE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_NEWLINE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_DIGIT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_LETTER] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_E] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_N] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_T] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_LT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_GT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_DOT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_EQUALS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_TILDE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_PERCENT] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_CARET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_PLUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_ASTERISK] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_LPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_RPAREN] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_COLON] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_COMMA] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_HASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_SLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, 0, T_DOUBLE_SLASH },
+        [CHAR_CLASS_MINUS] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_QUOTE] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_BACKSLASH] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_LBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+        [CHAR_CLASS_RBRACKET] = { SCANNER_STATE_START, SCANNER_ACTION_EMIT, SCANNER_FLAG_UNREAD, T_SLASH },
+    },
+};
@@ -22,18 +22,26 @@
 #include "dynstring.h"
 #include "parser-generated.h"
 #include "error.h"
+#include "source.h"
 #include "type.h"
 
-#define TOKEN_BUF_LENGTH 2
+/// smallest source lexed on a separate thread by scanner_lex_ahead()
+#define SCANNER_PIPELINE_MIN_LENGTH (1 << 20)
+/// largest source whose byte offsets fit token_t
+#define SCANNER_MAX_SOURCE_LENGTH UINT32_MAX
 
 /**
  * @struct Definition of token type
+ *
+ * Identifier and string lexemes are views into the source buffer (string literals with escape
+ * sequences into a scanner owned copy), they stay valid until scanner_free() is called. Tokens
+ * carry only their byte offset, token_position() turns it into row and column for diagnostics.
  */
 typedef struct {
     term_type_t token_type;
-    int row, column;
+    uint32_t offset;
     union {
-        string_t string;
+        str_view_t lexeme;
         type_t type;
         int64_t integer;
         double number;
@@ -42,14 +50,18 @@ typedef struct {
 } token_t;
 
 /**
- * Assigns source file to global variable.
+ * Loads the whole source file into memory, tokens are then read from the buffer.
+ *
+ * scanner_free() has to be called even if this fails.
  *
  * @param source_file Pointer to source file to be read from.
+ * @return E_OK on success, E_INT if the source couldn't be read or is longer than
+ *         SCANNER_MAX_SOURCE_LENGTH bytes.
  */
-void scanner_init(FILE *source_file);
+int scanner_init(FILE *source_file);
 
 /**
- * Closes file assigned *fptr.
+ * Releases the source buffer and closes file assigned *fptr.
  *
  * @param fp Pointer to input stream.
  * @return E_OK on success, otherwise E_LEX.
@@ -57,7 +69,38 @@ void scanner_init(FILE *source_file);
 int scanner_free(void);
 
 /**
- * Main function of scanner, which gets the next token from *fptr.
+ * Lexes the rest of the source into the token array at once.
+ *
+ * Tokens are otherwise lexed on demand, calling this first separates lexing from parsing. A lexical
+ * error ends the array, get_next_token() returns it again once it gets there.
+ *
+ * @return E_OK if the whole source was tokenized, otherwise E_LEX or E_INT (malloc err).
+ */
+int scanner_tokenize(void);
+
+/**
+ * Starts lexing on a separate thread, which hands tokens to get_next_token() in batches.
+ *
+ * The thread waits when the parser falls behind and is stopped by scanner_free(). A lexical error
+ * ends the stream the same way it ends the token array.
+ *
+ * @return E_OK if the thread runs or there is nothing left to lex, E_INT if it couldn't start.
+ */
+int scanner_pipeline(void);
+
+/**
+ * Lexes ahead of the parser with scanner_tokenize().
+ *
+ * When built with -DSCANNER_PIPELINE, sources of at least SCANNER_PIPELINE_MIN_LENGTH bytes are
+ * lexed on a separate thread on multi-core machines instead. It's off by default, lexing is only
+ * a small part of a compilation, so the thread barely shortens it.
+ */
+void scanner_lex_ahead(void);
+
+/**
+ * Main function of scanner, which gets the next token from the token array.
+ *
+ * After the last token, T_EOF or a lexical error is returned again on every call.
  *
  * @param[out] t Pointer to token to be assigned type (and value).
  * @return E_OK if tokenization is successful, otherwise E_LEX or E_INT (malloc err).
@@ -65,8 +108,25 @@ int scanner_free(void);
 int get_next_token(token_t *t);
 
 /**
- * Return up to TOKEN_BUF_LENGTH tokens for later use.
+ * Looks at a token ahead without consuming it.
  *
- * @return E_OK on success, otherwise return E_LEX.
+ * @param n Number of tokens to look past, 0 is the token the next get_next_token() returns.
+ * @param[out] t Pointer to token to be assigned type (and value).
+ * @return E_OK if tokenization is successful, otherwise E_LEX or E_INT (malloc err).
+ */
+int peek_token(size_t n, token_t *t);
+
+/**
+ * Returns the last read token back, any number of tokens can be returned.
+ *
+ * @return E_OK on success, E_LEX if no token has been read.
  */
 int unget_token(void);
+
+/**
+ * Finds row and column of a token, the index of lines is built on the first call.
+ *
+ * @param t Token read since the last scanner_init().
+ * @return Position of the first char of the token, row 0 on allocation error.
+ */
+source_position_t token_position(const token_t *t);
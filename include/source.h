@@ -0,0 +1,68 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file source.h
+ *
+ * @brief Whole-file source reader
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * @brief Contents of a source file held in a single contiguous buffer
+ */
+typedef struct {
+    const char *data;  ///< source bytes, not null terminated
+    size_t length;     ///< number of bytes in data
+    bool mapped;       ///< data is memory mapped, otherwise heap allocated
+    size_t *lines;     ///< offsets of line starts, built by source_position(), NULL until then
+    size_t line_count; ///< number of offsets in lines
+} source_t;
+
+/**
+ * @brief Row and column of a byte in the source, both numbered from one
+ */
+typedef struct {
+    size_t row;
+    size_t column;
+} source_position_t;
+
+/**
+ * @brief Reads the whole input stream into memory.
+ *
+ * Regular files are memory mapped, other streams (pipes, terminals) are read
+ * in large blocks into a heap buffer.
+ *
+ * @param source pointer to source structure
+ * @param file stream to be read
+ * @return E_INT on read or allocation error, otherwise E_OK
+ */
+int source_open(source_t *source, FILE *file);
+
+/**
+ * @brief Releases source contents
+ *
+ * @param source pointer to source structure
+ */
+void source_close(source_t *source);
+
+/**
+ * @brief Finds row and column of a byte offset in the source
+ *
+ * The index of line starts is built on the first call, so only diagnostics pay for it.
+ *
+ * @param source pointer to source structure
+ * @param offset byte offset, at most source->length
+ * @return position of the byte, row 0 if the index couldn't be allocated
+ */
+source_position_t source_position(source_t *source, size_t offset);
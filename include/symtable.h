@@ -14,8 +14,9 @@
  */
 #pragma once
 
-#include "hashtable_bst.h"
+#include "atom.h"
 #include "ast.h"
+#include "pool.h"
 
 /**
  * @brief Initializes symtable stack
@@ -46,44 +47,44 @@ int symtable_pop_scope();
 /**
  * @brief Inserts symbol into current scope
  *
- * @param identifier string id
+ * @param identifier interned id
  * @param data pointer to symbol data structure
  * @return E_INT on allocation error or empty symtable, othewise E_OK
  */
-int symtable_put_symbol(const char *identifier, ast_node_t *data);
+int symtable_put_symbol(atom_t identifier, ast_node_t *data);
 
 /**
  * @brief Inserts symbol into global
  *
- * @param identifier string id
+ * @param identifier interned id
  * @param data pointer to symbol data structure
  * @return E_INT on allocation error or empty symtable, othewise E_OK
  */
-int symtable_put_in_global(const char *identifier, ast_node_t *data);
+int symtable_put_in_global(atom_t identifier, ast_node_t *data);
 
 /**
  * @brief Tries to find symbol in all scopes
  *
- * @param identifier string id
+ * @param identifier interned id
  * @return pointer to symbol data if found, othewise NULL
  */
-ast_node_t *symtable_find(const char *identifier);
+ast_node_t *symtable_find(atom_t identifier);
 
 /**
  * @brief Tries to find symbol in global scope
  *
- * @param identifier string id
+ * @param identifier interned id
  * @return pointer to symbol data if found, othewise NULL
  */
-ast_node_t *symtable_find_in_global(const char *identifier);
+ast_node_t *symtable_find_in_global(atom_t identifier);
 
 /**
  * @brief Tries to find symbol in only current scope
  *
- * @param identifier string id
+ * @param identifier interned id
  * @return pointer to symbol data if found, othewise NULL
  */
-ast_node_t *symtable_find_in_current(const char *identifier);
+ast_node_t *symtable_find_in_current(atom_t identifier);
 
 /**
  * @brief Returns depth of current scope
@@ -91,3 +92,8 @@ ast_node_t *symtable_find_in_current(const char *identifier);
  * @return number from 0 to n
  */
 int symtable_scope_level();
+
+/**
+ * @brief Returns counters of the pool bindings are allocated from
+ */
+pool_stats_t symtable_pool_stats();
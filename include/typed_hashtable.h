@@ -0,0 +1,216 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file typed_hashtable.h
+ *
+ * @brief Type-specialized hashtable container
+ *
+ * DEFINE_HASHTABLE(name, key_type, value_type, hash, equal) defines name_t, an open
+ * addressing table with Robin Hood linear probing and static inline name_* functions
+ * operating on it. Hash and equal are called directly, so they get inlined instead of
+ * dispatched through pointers.
+ *
+ * Every entry is kept as close to its home slot (hash & mask) as possible,
+ * an inserted entry takes the slot of any entry that is closer to its own
+ * home. Probe sequences stay short and a lookup can stop as soon as it meets
+ * an entry closer to home than the key would be. Erase shifts the following
+ * entries back, so no tombstones are needed.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "error.h"
+
+/// minimal number of slots, has to be a power of two
+#define TYPED_HASHTABLE_MIN_SIZE (8)
+
+/**
+ * @brief Defines hashtable mapping key_type to value_type
+ *
+ * Keys have to be pointers, NULL marks an empty slot. hash(key) returns uint64_t and
+ * equal(a, b) returns true for equal keys.
+ *
+ * name_create(table, size) - allocates at least size slots, E_INT on allocation error
+ * name_free(table) - frees the slots
+ * name_insert(table, key, value) - inserts or replaces value of key, E_INT on allocation error
+ * name_find(table, key) - pointer to value of key, NULL if key isn't present
+ * name_erase(table, key) - erases key if present
+ *
+ * Tables keyed by another hash than hash(key) use the functions taking it:
+ * name_lookup(table, key, hash_value) - slot index of key, table->size if key isn't present
+ * name_insert_hashed(table, key, hash_value, value) - name_insert with known hash
+ * name_erase_at(table, index) - erases entry at slot index
+ * name_empty(table) - true if table is empty
+ */
+#define DEFINE_HASHTABLE(name, key_type, value_type, hash, equal)                                  \
+    typedef struct {                                                                               \
+        uint64_t hash_value; /* cached hash of key */                                              \
+        key_type key;                                                                              \
+        value_type value;                                                                          \
+    } name##_slot_t;                                                                               \
+                                                                                                   \
+    typedef struct {                                                                               \
+        size_t size; /* number of slots, power of two */                                           \
+        size_t load; /* number of entries */                                                       \
+        name##_slot_t *slots;                                                                      \
+    } name##_t;                                                                                    \
+                                                                                                   \
+    static inline size_t name##_probe_distance(const name##_t *table, uint64_t hash_value,         \
+                                               size_t index)                                       \
+    {                                                                                              \
+        return (index - (size_t) hash_value) & (table->size - 1);                                  \
+    }                                                                                              \
+                                                                                                   \
+    /* places an entry which is known not to be in the table yet */                                \
+    static inline void name##_place(name##_t *table, name##_slot_t entry)                          \
+    {                                                                                              \
+        size_t mask = table->size - 1;                                                             \
+        size_t index = entry.hash_value & mask;                                                    \
+        size_t distance = 0;                                                                       \
+        while(table->slots[index].key) {                                                           \
+            size_t existing = name##_probe_distance(table, table->slots[index].hash_value, index); \
+            if(existing < distance) {                                                              \
+                name##_slot_t tmp = table->slots[index];                                           \
+                table->slots[index] = entry;                                                       \
+                entry = tmp;                                                                       \
+                distance = existing;                                                               \
+            }                                                                                      \
+            index = (index + 1) & mask;                                                            \
+            distance++;                                                                            \
+        }                                                                                          \
+        table->slots[index] = entry;                                                               \
+        table->load++;                                                                             \
+    }                                                                                              \
+                                                                                                   \
+    static inline int name##_create(name##_t *table, size_t size)                                  \
+    {                                                                                              \
+        size_t capacity = TYPED_HASHTABLE_MIN_SIZE;                                                \
+        while(capacity < size) {                                                                   \
+            capacity *= 2;                                                                         \
+        }                                                                                          \
+        /* calloc leaves every key NULL, which marks empty slots */                                \
+        table->slots = (name##_slot_t *) calloc(capacity, sizeof(name##_slot_t));                  \
+        if(!table->slots) {                                                                        \
+            return E_INT;                                                                          \
+        }                                                                                          \
+        table->size = capacity;                                                                    \
+        table->load = 0;                                                                           \
+        return E_OK;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline void name##_free(name##_t *table)                                                \
+    {                                                                                              \
+        free(table->slots);                                                                        \
+        table->slots = NULL;                                                                       \
+        table->size = 0;                                                                           \
+        table->load = 0;                                                                           \
+    }                                                                                              \
+                                                                                                   \
+    static inline int name##_grow(name##_t *table)                                                 \
+    {                                                                                              \
+        size_t old_size = table->size;                                                             \
+        name##_slot_t *old_slots = table->slots;                                                   \
+        name##_slot_t *slots = (name##_slot_t *) calloc(2 * old_size, sizeof(name##_slot_t));      \
+        if(!slots) {                                                                               \
+            return E_INT;                                                                          \
+        }                                                                                          \
+        table->slots = slots;                                                                      \
+        table->size = 2 * old_size;                                                                \
+        table->load = 0;                                                                           \
+        for(size_t i = 0; i < old_size; i++) {                                                     \
+            if(old_slots[i].key) {                                                                 \
+                name##_place(table, old_slots[i]);                                                 \
+            }                                                                                      \
+        }                                                                                          \
+        free(old_slots);                                                                           \
+        return E_OK;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    /* returns slot index of key or table->size if key isn't present */                            \
+    static inline size_t name##_lookup(const name##_t *table, key_type key, uint64_t hash_value)   \
+    {                                                                                              \
+        size_t mask = table->size - 1;                                                             \
+        size_t index = hash_value & mask;                                                          \
+        for(size_t distance = 0;; distance++) {                                                    \
+            const name##_slot_t *slot = &table->slots[index];                                      \
+            if(!slot->key || name##_probe_distance(table, slot->hash_value, index) < distance) {   \
+                return table->size;                                                                \
+            }                                                                                      \
+            if(slot->hash_value == hash_value && equal(slot->key, key)) {                          \
+                return index;                                                                      \
+            }                                                                                      \
+            index = (index + 1) & mask;                                                            \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    static inline value_type *name##_find(name##_t *table, key_type key)                           \
+    {                                                                                              \
+        size_t index = name##_lookup(table, key, hash(key));                                       \
+        return index == table->size ? NULL : &table->slots[index].value;                           \
+    }                                                                                              \
+                                                                                                   \
+    /* inserts or replaces value of key whose hash is already known */                             \
+    static inline int name##_insert_hashed(name##_t *table, key_type key, uint64_t hash_value,     \
+                                           value_type value)                                       \
+    {                                                                                              \
+        size_t index = name##_lookup(table, key, hash_value);                                      \
+        if(index != table->size) {                                                                 \
+            table->slots[index].value = value;                                                     \
+            return E_OK;                                                                           \
+        }                                                                                          \
+        /* keep load factor at most 3/4 */                                                         \
+        if(4 * (table->load + 1) > 3 * table->size && name##_grow(table) != E_OK) {                \
+            return E_INT;                                                                          \
+        }                                                                                          \
+        name##_slot_t entry;                                                                       \
+        entry.hash_value = hash_value;                                                             \
+        entry.key = key;                                                                           \
+        entry.value = value;                                                                       \
+        name##_place(table, entry);                                                                \
+        return E_OK;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline int name##_insert(name##_t *table, key_type key, value_type value)               \
+    {                                                                                              \
+        return name##_insert_hashed(table, key, hash(key), value);                                 \
+    }                                                                                              \
+                                                                                                   \
+    /* erases entry at slot index, backward shift deletion leaves no tombstones */                 \
+    static inline void name##_erase_at(name##_t *table, size_t index)                              \
+    {                                                                                              \
+        size_t mask = table->size - 1;                                                             \
+        size_t next = (index + 1) & mask;                                                          \
+        while(table->slots[next].key &&                                                            \
+              name##_probe_distance(table, table->slots[next].hash_value, next) > 0) {             \
+            table->slots[index] = table->slots[next];                                              \
+            index = next;                                                                          \
+            next = (next + 1) & mask;                                                              \
+        }                                                                                          \
+        memset(&table->slots[index], 0, sizeof(name##_slot_t));                                    \
+        table->load--;                                                                             \
+    }                                                                                              \
+                                                                                                   \
+    static inline void name##_erase(name##_t *table, key_type key)                                 \
+    {                                                                                              \
+        size_t index = name##_lookup(table, key, hash(key));                                       \
+        if(index != table->size) {                                                                 \
+            name##_erase_at(table, index);                                                         \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    static inline bool name##_empty(const name##_t *table)                                         \
+    {                                                                                              \
+        return table->load == 0;                                                                   \
+    }
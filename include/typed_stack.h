@@ -0,0 +1,119 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file typed_stack.h
+ *
+ * @brief Type-specialized stack container
+ *
+ * DEFINE_STACK(name, type) defines name_t, a stack of type stored by value, and
+ * static inline name_* functions operating on it. The array can start in a
+ * caller provided buffer (usually on the C stack), it moves to the heap once the
+ * buffer is full. Pointers to elements are invalidated by pushing.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "error.h"
+
+/// capacity of the first heap array
+#define TYPED_STACK_MIN_CAPACITY 8
+
+/**
+ * @brief Defines stack of type
+ *
+ * name_create(stack) - creates an empty stack without allocating
+ * name_create_buffer(stack, buffer, capacity) - creates an empty stack in buffer, not freed later
+ * name_free(stack) - frees the array, stack is empty and without buffer afterwards
+ * name_reserve(stack, capacity) - grows array to hold capacity elements, E_INT on allocation error
+ * name_push(stack, value) - pushes value, E_INT on allocation error
+ * name_pop(stack) - removes and returns the top element, stack mustn't be empty
+ * name_top(stack) - pointer to the top element, stack mustn't be empty
+ * name_empty(stack) - true if stack is empty
+ */
+#define DEFINE_STACK(name, type)                                                                   \
+    typedef struct {                                                                               \
+        size_t size;     /* number of elements */                                                  \
+        size_t capacity; /* number of elements array holds */                                      \
+        type *array;                                                                               \
+        type *buffer; /* caller provided array, not freed */                                       \
+    } name##_t;                                                                                    \
+                                                                                                   \
+    static inline void name##_create_buffer(name##_t *stack, type *buffer, size_t capacity)        \
+    {                                                                                              \
+        stack->size = 0;                                                                           \
+        stack->capacity = capacity;                                                                \
+        stack->array = buffer;                                                                     \
+        stack->buffer = buffer;                                                                    \
+    }                                                                                              \
+                                                                                                   \
+    static inline void name##_create(name##_t *stack)                                              \
+    {                                                                                              \
+        name##_create_buffer(stack, NULL, 0);                                                      \
+    }                                                                                              \
+                                                                                                   \
+    static inline void name##_free(name##_t *stack)                                                \
+    {                                                                                              \
+        if(stack->array != stack->buffer) {                                                        \
+            free(stack->array);                                                                    \
+        }                                                                                          \
+        name##_create(stack);                                                                      \
+    }                                                                                              \
+                                                                                                   \
+    static inline int name##_reserve(name##_t *stack, size_t capacity)                             \
+    {                                                                                              \
+        if(capacity <= stack->capacity) {                                                          \
+            return E_OK;                                                                           \
+        }                                                                                          \
+        type *array;                                                                               \
+        if(stack->array == stack->buffer) {                                                        \
+            array = (type *) malloc(capacity * sizeof(type));                                      \
+            if(array && stack->size) {                                                             \
+                memcpy(array, stack->array, stack->size * sizeof(type));                           \
+            }                                                                                      \
+        } else {                                                                                   \
+            array = (type *) realloc(stack->array, capacity * sizeof(type));                       \
+        }                                                                                          \
+        if(!array) {                                                                               \
+            return E_INT;                                                                          \
+        }                                                                                          \
+        stack->array = array;                                                                      \
+        stack->capacity = capacity;                                                                \
+        return E_OK;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline int name##_push(name##_t *stack, type value)                                     \
+    {                                                                                              \
+        if(stack->size == stack->capacity &&                                                       \
+           name##_reserve(stack, stack->capacity ? 2 * stack->capacity                             \
+                                                 : TYPED_STACK_MIN_CAPACITY) != E_OK) {            \
+            return E_INT;                                                                          \
+        }                                                                                          \
+        stack->array[stack->size++] = value;                                                       \
+        return E_OK;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline type name##_pop(name##_t *stack)                                                 \
+    {                                                                                              \
+        return stack->array[--stack->size];                                                        \
+    }                                                                                              \
+                                                                                                   \
+    static inline type *name##_top(name##_t *stack)                                                \
+    {                                                                                              \
+        return &stack->array[stack->size - 1];                                                     \
+    }                                                                                              \
+                                                                                                   \
+    static inline bool name##_empty(const name##_t *stack)                                         \
+    {                                                                                              \
+        return stack->size == 0;                                                                   \
+    }
@@ -0,0 +1,103 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xrozek02 Jakub Rozek
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file ast.c
+ *
+ * @brief AST memory of the compilation unit
+ */
+#include "ast.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "arena.h"
+#include "error.h"
+
+static arena_t arena;
+
+void *ast_alloc(size_t size)
+{
+    return arena_alloc(&arena, size);
+}
+
+/// size of node header followed by union member
+#define NODE_SIZE(member) (offsetof(ast_node_t, member) + sizeof(((ast_node_t *) NULL)->member))
+/// size of node without any union member
+#define NODE_HEADER_SIZE (offsetof(ast_node_t, integer))
+
+static const size_t node_sizes[] = {
+    [AST_NODE_INVALID] = NODE_HEADER_SIZE,
+    [AST_NODE_FUNC_DECL] = NODE_SIZE(func_decl),
+    [AST_NODE_FUNC_DEF] = NODE_SIZE(func_def),
+    [AST_NODE_FUNC_CALL] = NODE_SIZE(func_call),
+    [AST_NODE_DECLARATION] = NODE_SIZE(declaration),
+    [AST_NODE_ASSIGNMENT] = NODE_SIZE(assignment),
+    [AST_NODE_PROGRAM] = NODE_SIZE(program),
+    [AST_NODE_BODY] = NODE_SIZE(body),
+    [AST_NODE_IF] = NODE_SIZE(if_condition),
+    [AST_NODE_WHILE] = NODE_SIZE(while_loop),
+    [AST_NODE_FOR] = NODE_SIZE(for_loop),
+    [AST_NODE_REPEAT] = NODE_SIZE(repeat_loop),
+    [AST_NODE_BREAK] = NODE_HEADER_SIZE,
+    [AST_NODE_RETURN] = NODE_SIZE(return_values),
+    [AST_NODE_BINOP] = NODE_SIZE(binop),
+    [AST_NODE_UNOP] = NODE_SIZE(unop),
+    [AST_NODE_TYPE] = NODE_SIZE(type),
+    [AST_NODE_SYMBOL] = NODE_SIZE(symbol),
+    [AST_NODE_INTEGER] = NODE_SIZE(integer),
+    [AST_NODE_NUMBER] = NODE_SIZE(number),
+    [AST_NODE_BOOLEAN] = NODE_SIZE(boolean),
+    [AST_NODE_STRING] = NODE_SIZE(string),
+    [AST_NODE_NIL] = NODE_HEADER_SIZE,
+};
+
+/// node of kind `from` is turned into kind `to` in place, it has to be large enough
+#define NODE_CONVERTIBLE(from, to)                                                                 \
+    _Static_assert(NODE_SIZE(to) <= NODE_SIZE(from), #from " node can't hold " #to)
+
+// conversions done by the optimizer, folded operations and propagated constants become literals
+NODE_CONVERTIBLE(binop, integer);
+NODE_CONVERTIBLE(binop, number);
+NODE_CONVERTIBLE(binop, boolean);
+NODE_CONVERTIBLE(binop, string);
+NODE_CONVERTIBLE(unop, integer);
+NODE_CONVERTIBLE(unop, number);
+NODE_CONVERTIBLE(unop, boolean);
+NODE_CONVERTIBLE(symbol, integer);
+NODE_CONVERTIBLE(symbol, number);
+NODE_CONVERTIBLE(symbol, boolean);
+NODE_CONVERTIBLE(symbol, string);
+NODE_CONVERTIBLE(if_condition, body);
+
+ast_node_t *ast_alloc_node(ast_node_type_t type)
+{
+    ast_node_t *node = arena_alloc(&arena, node_sizes[type]);
+    if(node) {
+        node->node_type = type;
+    }
+    return node;
+}
+
+int ast_alloc_string(const char *s, size_t length, ast_string_t *str)
+{
+    char *ptr = arena_alloc(&arena, length + 1);
+    if(!ptr) {
+        return E_INT;
+    }
+    memcpy(ptr, s, length);
+    str->ptr = ptr;
+    str->length = length;
+    return E_OK;
+}
+
+void ast_free()
+{
+    arena_free(&arena);
+}
@@ -18,10 +18,13 @@
 #include "ast.h"
 #include <string.h>
 #include <ctype.h>
-#include "hashtable_bst.h"
+#include "typed_hashtable.h"
 #include "semantics.h"
 #include "optimizations.h"
-#include "stack.h"
+#include "typed_stack.h"
+
+DEFINE_HASHTABLE(declaration_set, atom_t, bool, atom_hash, atom_equal)
+DEFINE_STACK(node_stack, ast_node_t *)
 
 static bool comments = false;
 
@@ -107,16 +110,24 @@ void process_assignment_node(ast_node_t *cur_node);
 
 void process_node_func_call(ast_node_t *cur_node);
 
-void process_for_node(ast_node_t *for_node);
+void process_for_start(ast_node_t *for_node, int *local_label_counter,
+                       int *second_local_label_counter);
+
+void process_for_end(ast_node_t *for_node, int local_label_counter, int second_local_label_counter);
+
+void generate_if_start(ast_node_t *condition, int *internal_label);
 
-void generate_if_code(ast_node_t *condition, ast_node_t *body, int local_label_counter,
-                      int break_label);
+void generate_if_end(int local_label_counter, int internal_label);
 
-void process_if_node(ast_node_t *cur_node, int break_label);
+void process_while_start(ast_node_t *cur_node, int *local_label_counter,
+                         int *second_local_label_counter);
 
-void process_while_node(ast_node_t *cur_node);
+void process_while_end(int local_label_counter, int second_local_label_counter);
 
-void process_repeat_until(ast_node_t *cur_node);
+void process_repeat_start(int *local_label_counter, int *second_local_label_counter);
+
+void process_repeat_end(ast_node_t *cur_node, int local_label_counter,
+                        int second_local_label_counter);
 
 void process_node_func_def(ast_node_t *cur_node);
 
@@ -147,7 +158,7 @@ void push_nil_arg();
 
 void generate_write(int arg_count);
 
-void generate_func_start(char *function_name);
+void generate_func_start(const char *function_name);
 
 void generate_func_arg(symbol_t *symbol, int i);
 
@@ -215,14 +226,8 @@ void generate_nil_assignment();
 
 void generate_func_call_assignment_decl(ast_node_t *rvalue);
 
-static uint64_t hash(const char *key)
-{
-    uint64_t h = 0;
-    for(const char *c = key; *c != '\0'; ++c) {
-        h = ((h << 5) ^ (h >> 27)) ^ *c;
-    }
-    return h;
-}
+/// atom of the write builtin, calls to write are generated inline
+static atom_t atom_write;
 
 void exponent_float_to_integer()
 {
@@ -265,15 +270,20 @@ void process_unop_node(ast_node_t *unop_node);
 void process_node(ast_node_t *cur_node, int break_label);
 void generate_result();
 
-char *get_symbol_name(symbol_t *node_symbol)
+static atom_t get_symbol_atom(symbol_t *node_symbol)
 {
     if(node_symbol->is_declaration) {
-        return node_symbol->name.ptr;
+        return node_symbol->name;
     } else {
-        return get_symbol_name(node_symbol->declaration);
+        return get_symbol_atom(node_symbol->declaration);
     }
 }
 
+const char *get_symbol_name(symbol_t *node_symbol)
+{
+    return get_symbol_atom(node_symbol)->str;
+}
+
 void print_symbol(symbol_t *symbol)
 {
     printf("%s", get_symbol_name(symbol));
@@ -351,7 +361,7 @@ void generate_write(int arg_count)
     }
 }
 
-void generate_func_start(char *function_name)
+void generate_func_start(const char *function_name)
 {
     OUTPUT_CODE_PART("LABEL $");
     OUTPUT_CODE_LINE(function_name);
@@ -360,7 +370,7 @@ void generate_func_start(char *function_name)
 
 void generate_func_arg(symbol_t *symbol, int i)
 {
-    char *id = get_symbol_name(symbol);
+    const char *id = get_symbol_name(symbol);
     OUTPUT_CODE_PART("DEFVAR LF@");
     printf("%s\n", id);
     OUTPUT_CODE_PART("MOVE LF@");
@@ -378,11 +388,11 @@ void generate_func_retval_dec(int i)
     OUTPUT_CODE_LINE("nil@nil");
 }
 
-hashtable_t declarations;
+declaration_set_t declarations;
 
 void process_node_func_def(ast_node_t *cur_node)
 {
-    generate_func_start(cur_node->func_def.name.ptr);
+    generate_func_start(cur_node->func_def.name->str);
 
     ast_node_t *arg = cur_node->func_def.arguments;
     int arg_counter = 0;
@@ -400,9 +410,9 @@ void process_node_func_def(ast_node_t *cur_node)
         retval_counter++;
     }
 
-    hashtable_create_bst(&declarations, 47, hash);
+    declaration_set_create(&declarations, 64);
     look_for_declarations(cur_node->func_def.body);
-    hashtable_free(&declarations);
+    declaration_set_free(&declarations);
     process_node(cur_node->func_def.body, 0);
     global_func_counter++;
     OUTPUT_CODE_LINE("POPFRAME");
@@ -1027,12 +1037,11 @@ void generate_func_call_assignment_decl(ast_node_t *rvalue)
 
 void generate_declaration(symbol_t *symbol)
 {
-    char *id = get_symbol_name(symbol);
+    atom_t id = get_symbol_atom(symbol);
 
-    void *garbo = NULL;
-    if(hashtable_find(&declarations, id, &garbo) != E_OK) {
-        hashtable_insert(&declarations, id, NULL);
-        printf("DEFVAR LF@%s\n", id);
+    if(!declaration_set_find(&declarations, id)) {
+        declaration_set_insert(&declarations, id, true);
+        printf("DEFVAR LF@%s\n", id->str);
     }
 }
 
@@ -1119,8 +1128,9 @@ void process_assignment_node(ast_node_t *cur_node)
         expression_iterator = expression_iterator->next;
     }
 
-    adt_stack_t stack;
-    if(stack_create(&stack, rside_counter * 2) != E_OK) {
+    node_stack_t stack;
+    node_stack_create(&stack);
+    if(node_stack_reserve(&stack, rside_counter * 2) != E_OK) {
         // todo error
     }
 
@@ -1138,15 +1148,14 @@ void process_assignment_node(ast_node_t *cur_node)
             {
                 bool push = false;
                 for(ast_node_t *it = cur_node->assignment.identifiers; it; it = it->next) {
-                    if(strcmp(it->symbol.declaration->name.ptr,
-                              identifier->symbol.declaration->name.ptr) == 0) {
+                    if(it->symbol.declaration->name == identifier->symbol.declaration->name) {
                         push = true;
                         break;
                     }
                 }
                 if(push) {
                     OUTPUT_CODE("PUSHS LF@%s\n", get_symbol_name(&expression->symbol));
-                    stack_push(&stack, identifier);
+                    node_stack_push(&stack, identifier);
                 } else {
                     OUTPUT_CODE("MOVE LF@%s ", get_symbol_name(&identifier->symbol));
                     generate_symbol_push(expression);
@@ -1200,15 +1209,15 @@ void process_assignment_node(ast_node_t *cur_node)
             //            OUTPUT_CODE_LINE("\n");
             break;
         case AST_NODE_FUNC_CALL:
-            stack_push(&stack, identifier);
+            node_stack_push(&stack, identifier);
             if(!expression->next) {
                 identifier = identifier->next;
                 while(identifier) {
-                    stack_push(&stack, identifier);
+                    node_stack_push(&stack, identifier);
                     identifier = identifier->next;
                 }
             }
-            stack_push(&stack, expression);
+            node_stack_push(&stack, expression);
             // break;
             generate_func_call_assignment_RL(expression, lside_counter - (rside_counter - 1));
             break;
@@ -1217,8 +1226,8 @@ void process_assignment_node(ast_node_t *cur_node)
             //            OUTPUT_CODE_PART("PUSHS ");
             //            generate_result();
             process_binop_node(expression);
-            stack_push(&stack, identifier);
-            stack_push(&stack, expression);
+            node_stack_push(&stack, identifier);
+            node_stack_push(&stack, expression);
             break;
         case AST_NODE_UNOP:
             // generate_unop_assignment(expression);
@@ -1226,8 +1235,8 @@ void process_assignment_node(ast_node_t *cur_node)
             // generate_result();
             process_unop_node(expression);
 
-            stack_push(&stack, identifier);
-            stack_push(&stack, expression);
+            node_stack_push(&stack, identifier);
+            node_stack_push(&stack, expression);
             break;
         default:
             break;
@@ -1240,13 +1249,13 @@ void process_assignment_node(ast_node_t *cur_node)
         identifier = identifier->next;
     }
 
-    while(!stack_empty(&stack)) {
-        ast_node_t *expression = stack_pop(&stack);
+    while(!node_stack_empty(&stack)) {
+        ast_node_t *expression = node_stack_pop(&stack);
         if(expression->node_type == AST_NODE_SYMBOL) {
             OUTPUT_CODE("POPS LF@%s\n", get_symbol_name(&expression->symbol));
             continue;
         }
-        ast_node_t *identifier = stack_pop(&stack);
+        ast_node_t *identifier = node_stack_pop(&stack);
 
         switch(expression->node_type) {
         case AST_NODE_FUNC_CALL: {
@@ -1255,8 +1264,8 @@ void process_assignment_node(ast_node_t *cur_node)
             // 1));
             OUTPUT_CODE("POPS LF@%s\n", get_symbol_name(&identifier->symbol));
             if(!expression->next) {
-                while(!stack_empty(&stack)) {
-                    ast_node_t *identifier = stack_pop(&stack);
+                while(!node_stack_empty(&stack)) {
+                    ast_node_t *identifier = node_stack_pop(&stack);
                     OUTPUT_CODE("POPS LF@%s\n", get_symbol_name(&identifier->symbol));
                 }
             }
@@ -1282,7 +1291,7 @@ void process_assignment_node(ast_node_t *cur_node)
         }
     }
 
-    stack_free(&stack);
+    node_stack_free(&stack);
 
     //    int cur_max_exp = rside_counter - 1;
     //    for(int l = 0; l < rside_counter; l++) {
@@ -1349,7 +1358,7 @@ void process_assignment_node(ast_node_t *cur_node)
 void process_node_func_call(ast_node_t *cur_node)
 {
     int lside_counter;
-    if(strcmp(cur_node->func_call.name.ptr, "write")) { // If it's not write()
+    if(cur_node->func_call.name != atom_write) { // If it's not write()
         if(cur_node->func_call.def) {
             lside_counter = count_children(cur_node->func_call.def->arguments);
         } else {
@@ -1417,7 +1426,7 @@ void process_node_func_call(ast_node_t *cur_node)
         OUTPUT_CODE_LINE("POPS GF@trash"); // Losing unwanted expression results.
     }
     OUTPUT_CODE_LINE("CREATEFRAME");
-    if(!strcmp(cur_node->func_call.name.ptr, "write")) {
+    if(cur_node->func_call.name == atom_write) {
         lside_counter = lside_counter - 1 + added_to_write;
     }
 
@@ -1428,9 +1437,9 @@ void process_node_func_call(ast_node_t *cur_node)
     }
 
     // if not write
-    if(strcmp(cur_node->func_call.name.ptr, "write")) {
+    if(cur_node->func_call.name != atom_write) {
         OUTPUT_CODE_PART("CALL $");
-        printf("%s\n", cur_node->func_call.name.ptr);
+        printf("%s\n", cur_node->func_call.name->str);
     } else {
         generate_write(lside_counter);
     }
@@ -1465,29 +1474,28 @@ void eval_condition()
     OUTPUT_CODE_LINE("RETURN");
 }
 
-void process_for_node(ast_node_t *for_node)
+void process_for_start(ast_node_t *for_node, int *local_label_counter,
+                       int *second_local_label_counter)
 {
     global_label_counter++;
-    int local_label_counter = global_label_counter;
+    *local_label_counter = global_label_counter;
     global_label_counter++;
-    int second_local_label_counter = global_label_counter;
+    *second_local_label_counter = global_label_counter;
 
     ast_node_t *iterator = for_node->for_loop.iterator;
     ast_node_t *step = for_node->for_loop.step;
     ast_node_t *condition = for_node->for_loop.condition;
     ast_node_t *copy = for_node->for_loop.setup;
 
-    ast_node_t *body = for_node->for_loop.body;
-
     process_node(iterator, 0);
     process_node(step, 0);
     process_node(condition, 0);
     process_node(copy, 0);
 
-    char *iterator_name = get_symbol_name(&iterator->symbol);
-    char *step_name = get_symbol_name(&step->symbol);
-    char *condition_name = get_symbol_name(&condition->symbol);
-    char *copy_name = get_symbol_name(&copy->symbol);
+    const char *iterator_name = get_symbol_name(&iterator->symbol);
+    const char *step_name = get_symbol_name(&step->symbol);
+    const char *condition_name = get_symbol_name(&condition->symbol);
+    const char *copy_name = get_symbol_name(&copy->symbol);
 
     // Konvertuj iterator, step, condition na rovnaky typ.
     OUTPUT_CODE_PART("PUSHS ");
@@ -1509,7 +1517,7 @@ void process_for_node(ast_node_t *for_node)
     printf("LF@%s\n", condition_name);
 
     OUTPUT_CODE_PART("LABEL ");
-    output_label(local_label_counter);
+    output_label(*local_label_counter);
     OUTPUT_CODE_LINE("");
     OUTPUT_CODE_PART("MOVE ");
     printf("LF@%s ", copy_name);
@@ -1523,10 +1531,14 @@ void process_for_node(ast_node_t *for_node)
     OUTPUT_CODE_LINE("CALL SHOULD_I_JUMP");
     OUTPUT_CODE_LINE("POPS GF@result");
     OUTPUT_CODE_PART("JUMPIFEQ ");
-    output_label(second_local_label_counter);
+    output_label(*second_local_label_counter);
     OUTPUT_CODE_LINE(" GF@result bool@true");
+}
 
-    process_node(body, second_local_label_counter);
+void process_for_end(ast_node_t *for_node, int local_label_counter, int second_local_label_counter)
+{
+    const char *iterator_name = get_symbol_name(&for_node->for_loop.iterator->symbol);
+    const char *step_name = get_symbol_name(&for_node->for_loop.step->symbol);
 
     OUTPUT_CODE_PART("ADD ");
     printf("LF@%s ", iterator_name);
@@ -1611,11 +1623,10 @@ void for_convert()
     OUTPUT_CODE_LINE("EXIT int@8");
 }
 
-void generate_if_code(ast_node_t *condition, ast_node_t *body, int local_label_counter,
-                      int break_label)
+void generate_if_start(ast_node_t *condition, int *internal_label)
 {
     global_label_counter++;
-    int internal_label = global_label_counter;
+    *internal_label = global_label_counter;
     process_node(condition, 0);
 
     OUTPUT_CODE_LINE("CALL EVAL_CONDITION");
@@ -1623,11 +1634,12 @@ void generate_if_code(ast_node_t *condition, ast_node_t *body, int local_label_c
     OUTPUT_CODE_LINE("POPS GF@result");
 
     OUTPUT_CODE_PART("JUMPIFEQ ");
-    output_label(internal_label);
+    output_label(*internal_label);
     OUTPUT_CODE_LINE(" GF@result bool@false");
+}
 
-    process_node(body, break_label);
-
+void generate_if_end(int local_label_counter, int internal_label)
+{
     OUTPUT_CODE_PART("JUMP ");
     output_label(local_label_counter);
     OUTPUT_CODE_LINE("");
@@ -1636,45 +1648,28 @@ void generate_if_code(ast_node_t *condition, ast_node_t *body, int local_label_c
     OUTPUT_CODE_LINE("");
 }
 
-void process_if_node(ast_node_t *cur_node, int break_label)
-{
-    global_label_counter++;
-    int local_label_counter = global_label_counter;
-    ast_node_t *condition = cur_node->if_condition.conditions;
-    ast_node_t *body = cur_node->if_condition.bodies;
-    while(condition != NULL) {
-        generate_if_code(condition, body, local_label_counter, break_label);
-        condition = condition->next;
-        body = body->next;
-    }
-    if(body) {
-        process_node(body, break_label);
-    }
-    OUTPUT_CODE_PART("LABEL ");
-    output_label(local_label_counter);
-    OUTPUT_CODE_LINE("");
-}
-
-void process_while_node(ast_node_t *cur_node)
+void process_while_start(ast_node_t *cur_node, int *local_label_counter,
+                         int *second_local_label_counter)
 {
     global_label_counter++;
-    int local_label_counter = global_label_counter;
+    *local_label_counter = global_label_counter;
     global_label_counter++;
-    int second_local_label_counter = global_label_counter;
+    *second_local_label_counter = global_label_counter;
 
     ast_node_t *condition = cur_node->while_loop.condition;
-    ast_node_t *body = cur_node->while_loop.body;
     OUTPUT_CODE_PART("LABEL ");
-    output_label(local_label_counter);
+    output_label(*local_label_counter);
     OUTPUT_CODE_LINE("");
     process_node(condition, 0);
     OUTPUT_CODE_LINE("CALL EVAL_CONDITION");
     OUTPUT_CODE_LINE("POPS GF@result");
     OUTPUT_CODE_PART("JUMPIFEQ ");
-    output_label(second_local_label_counter);
+    output_label(*second_local_label_counter);
     OUTPUT_CODE_LINE(" GF@result bool@false");
-    process_node(body, second_local_label_counter);
+}
 
+void process_while_end(int local_label_counter, int second_local_label_counter)
+{
     OUTPUT_CODE_PART("JUMP ");
     output_label(local_label_counter);
     OUTPUT_CODE_LINE("");
@@ -1683,19 +1678,22 @@ void process_while_node(ast_node_t *cur_node)
     OUTPUT_CODE_LINE("");
 }
 
-void process_repeat_until(ast_node_t *cur_node)
+void process_repeat_start(int *local_label_counter, int *second_local_label_counter)
 {
     global_label_counter++;
-    int local_label_counter = global_label_counter;
+    *local_label_counter = global_label_counter;
     global_label_counter++;
-    int second_local_label_counter = global_label_counter;
+    *second_local_label_counter = global_label_counter;
 
-    ast_node_t *condition = cur_node->repeat_loop.condition;
-    ast_node_t *body = cur_node->repeat_loop.body;
     OUTPUT_CODE_PART("LABEL ");
-    output_label(local_label_counter);
+    output_label(*local_label_counter);
     OUTPUT_CODE_LINE("");
-    process_node(body, second_local_label_counter);
+}
+
+void process_repeat_end(ast_node_t *cur_node, int local_label_counter,
+                        int second_local_label_counter)
+{
+    ast_node_t *condition = cur_node->repeat_loop.condition;
     process_node(condition, 0);
     OUTPUT_CODE_LINE("CALL EVAL_CONDITION");
     OUTPUT_CODE_LINE("POPS GF@result");
@@ -1707,7 +1705,42 @@ void process_repeat_until(ast_node_t *cur_node)
     OUTPUT_CODE_LINE("");
 }
 
-void process_node(ast_node_t *cur_node, int break_label)
+/**
+ * @brief Step of the code generation, a frame of the explicit statement stack.
+ *
+ * Compound statements generate their code around the bodies in several steps, so nesting depth
+ * of the program doesn't nest calls.
+ */
+typedef enum
+{
+    GEN_NODE,          ///< generate node
+    GEN_LIST,          ///< generate node and the statements following it
+    GEN_IF_BRANCH,     ///< generate if branch with condition node and body, or the else branch
+    GEN_IF_BRANCH_END, ///< jump out of the if after a branch body
+    GEN_IF_END,
+    GEN_WHILE_END,
+    GEN_REPEAT_END,
+    GEN_FOR_END,
+} gen_step_t;
+
+typedef struct {
+    gen_step_t step;
+    ast_node_t *node;
+    ast_node_t *body; ///< body of the branch of GEN_IF_BRANCH
+    int break_label;
+    int local_label_counter;
+    int second_local_label_counter;
+} gen_frame_t;
+
+DEFINE_STACK(gen_stack, gen_frame_t)
+
+/// frames on the C stack, nesting deeper than that moves them to the heap
+#define GEN_STACK_INLINE_LENGTH 32
+
+/**
+ * @brief Generates code of a node which doesn't contain statements.
+ */
+static void process_leaf_node(ast_node_t *cur_node, int break_label)
 {
     switch(cur_node->node_type) {
     case AST_NODE_INVALID:
@@ -1754,22 +1787,6 @@ void process_node(ast_node_t *cur_node, int break_label)
         process_assignment_node(cur_node);
         break;
 
-    case AST_NODE_IF:
-        process_if_node(cur_node, break_label);
-        break;
-
-    case AST_NODE_WHILE:
-        process_while_node(cur_node);
-        break;
-
-    case AST_NODE_REPEAT:
-        process_repeat_until(cur_node);
-        break;
-
-    case AST_NODE_FOR:
-        process_for_node(cur_node);
-        break;
-
     case AST_NODE_RETURN:
         process_return_node(cur_node);
         break;
@@ -1777,11 +1794,6 @@ void process_node(ast_node_t *cur_node, int break_label)
     case AST_NODE_BINOP:
         process_binop_node(cur_node);
         break;
-    case AST_NODE_BODY:
-        for(ast_node_t *it = cur_node->body.statements; it != NULL; it = it->next) {
-            process_node(it, break_label);
-        }
-        break;
     case AST_NODE_BREAK:
         OUTPUT_CODE_LINE("JUMP "), output_label(break_label), printf("\n");
         break;
@@ -1790,43 +1802,216 @@ void process_node(ast_node_t *cur_node, int break_label)
     }
 }
 
-void look_for_declarations(ast_node_t *root)
+/**
+ * @brief Pushes the frame of a body, which is generated before the frames below it.
+ *
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+static int push_body(gen_stack_t *stack, gen_step_t step, ast_node_t *body, int break_label)
 {
+    gen_frame_t frame = { .step = step, .node = body, .break_label = break_label };
+    return gen_stack_push(stack, frame);
+}
+
+/**
+ * @brief Generates code of node, compound statements push the steps to finish them.
+ *
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+static int process_node_start(gen_stack_t *stack, ast_node_t *cur_node, int break_label)
+{
+    gen_frame_t end = { .node = cur_node, .break_label = break_label };
+
+    switch(cur_node->node_type) {
+    case AST_NODE_IF:
+        global_label_counter++;
+        end.step = GEN_IF_BRANCH;
+        end.node = cur_node->if_condition.conditions;
+        end.body = cur_node->if_condition.bodies;
+        end.local_label_counter = global_label_counter;
+        return gen_stack_push(stack, end);
 
-    switch(root->node_type) {
-    case AST_NODE_DECLARATION:
-        process_declaration_node(root, true);
-        break;
-    case AST_NODE_BODY: {
-        ast_node_t *body_statement = root->body.statements;
-        while(body_statement) {
-            look_for_declarations(body_statement);
-            body_statement = body_statement->next;
-        }
-        break;
-    }
-    case AST_NODE_IF: {
-        ast_node_list_t bodies = root->if_condition.bodies;
-        while(bodies) {
-            look_for_declarations(bodies);
-            bodies = bodies->next;
-        }
-    } break;
     case AST_NODE_WHILE:
-        look_for_declarations(root->while_loop.body);
-        break;
+        end.step = GEN_WHILE_END;
+        process_while_start(cur_node, &end.local_label_counter, &end.second_local_label_counter);
+        if(gen_stack_push(stack, end) != E_OK) {
+            return E_INT;
+        }
+        return push_body(stack, GEN_NODE, cur_node->while_loop.body,
+                         end.second_local_label_counter);
+
     case AST_NODE_REPEAT:
-        look_for_declarations(root->repeat_loop.body);
-        break;
+        end.step = GEN_REPEAT_END;
+        process_repeat_start(&end.local_label_counter, &end.second_local_label_counter);
+        if(gen_stack_push(stack, end) != E_OK) {
+            return E_INT;
+        }
+        return push_body(stack, GEN_NODE, cur_node->repeat_loop.body,
+                         end.second_local_label_counter);
+
     case AST_NODE_FOR:
-        look_for_declarations(root->for_loop.iterator);
-        look_for_declarations(root->for_loop.condition);
-        look_for_declarations(root->for_loop.step);
-        look_for_declarations(root->for_loop.setup);
-        break;
+        end.step = GEN_FOR_END;
+        process_for_start(cur_node, &end.local_label_counter, &end.second_local_label_counter);
+        if(gen_stack_push(stack, end) != E_OK) {
+            return E_INT;
+        }
+        return push_body(stack, GEN_NODE, cur_node->for_loop.body,
+                         end.second_local_label_counter);
+
+    case AST_NODE_BODY:
+        if(!cur_node->body.statements) {
+            return E_OK;
+        }
+        return push_body(stack, GEN_LIST, cur_node->body.statements, break_label);
+
     default:
-        break;
+        process_leaf_node(cur_node, break_label);
+        return E_OK;
+    }
+}
+
+/**
+ * @brief Generates code of the if branch in frame and pushes the steps following it.
+ *
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+static int process_if_branch(gen_stack_t *stack, gen_frame_t *frame)
+{
+    if(!frame->node) {
+        // else branch, or the end of the if without one
+        gen_frame_t end = *frame;
+        end.step = GEN_IF_END;
+        if(gen_stack_push(stack, end) != E_OK) {
+            return E_INT;
+        }
+        if(!frame->body) {
+            return E_OK;
+        }
+        return push_body(stack, GEN_NODE, frame->body, frame->break_label);
+    }
+
+    gen_frame_t next = *frame;
+    next.node = frame->node->next;
+    next.body = frame->body->next;
+    gen_frame_t end = *frame;
+    end.step = GEN_IF_BRANCH_END;
+
+    generate_if_start(frame->node, &end.second_local_label_counter);
+    if(gen_stack_push(stack, next) != E_OK || gen_stack_push(stack, end) != E_OK) {
+        return E_INT;
+    }
+    return push_body(stack, GEN_NODE, frame->body, frame->break_label);
+}
+
+void process_node(ast_node_t *cur_node, int break_label)
+{
+    gen_frame_t buffer[GEN_STACK_INLINE_LENGTH];
+    gen_stack_t stack;
+    gen_stack_create_buffer(&stack, buffer, GEN_STACK_INLINE_LENGTH);
+
+    int err = push_body(&stack, GEN_NODE, cur_node, break_label);
+    while(!err && !gen_stack_empty(&stack)) {
+        gen_frame_t frame = gen_stack_pop(&stack);
+        switch(frame.step) {
+        case GEN_NODE:
+            err = process_node_start(&stack, frame.node, frame.break_label);
+            break;
+        case GEN_LIST:
+            if(frame.node->next) {
+                err = push_body(&stack, GEN_LIST, frame.node->next, frame.break_label);
+            }
+            if(!err) {
+                err = process_node_start(&stack, frame.node, frame.break_label);
+            }
+            break;
+        case GEN_IF_BRANCH:
+            err = process_if_branch(&stack, &frame);
+            break;
+        case GEN_IF_BRANCH_END:
+            generate_if_end(frame.local_label_counter, frame.second_local_label_counter);
+            break;
+        case GEN_IF_END:
+            OUTPUT_CODE_PART("LABEL ");
+            output_label(frame.local_label_counter);
+            OUTPUT_CODE_LINE("");
+            break;
+        case GEN_WHILE_END:
+            process_while_end(frame.local_label_counter, frame.second_local_label_counter);
+            break;
+        case GEN_REPEAT_END:
+            process_repeat_end(frame.node, frame.local_label_counter,
+                               frame.second_local_label_counter);
+            break;
+        case GEN_FOR_END:
+            process_for_end(frame.node, frame.local_label_counter,
+                            frame.second_local_label_counter);
+            break;
+        }
+    }
+
+    if(err) {
+        fprintf(stderr, "error: not enough memory\n");
+    }
+    gen_stack_free(&stack);
+}
+
+void look_for_declarations(ast_node_t *root)
+{
+    gen_frame_t buffer[GEN_STACK_INLINE_LENGTH];
+    gen_stack_t stack;
+    gen_stack_create_buffer(&stack, buffer, GEN_STACK_INLINE_LENGTH);
+
+    // only GEN_NODE and GEN_LIST frames, there is nothing to generate after a body
+    int err = push_body(&stack, GEN_NODE, root, 0);
+    while(!err && !gen_stack_empty(&stack)) {
+        gen_frame_t frame = gen_stack_pop(&stack);
+        ast_node_t *node = frame.node;
+        if(frame.step == GEN_LIST && node->next) {
+            err = push_body(&stack, GEN_LIST, node->next, 0);
+        }
+
+        switch(node->node_type) {
+        case AST_NODE_DECLARATION:
+            process_declaration_node(node, true);
+            break;
+        case AST_NODE_BODY:
+            if(!err && node->body.statements) {
+                err = push_body(&stack, GEN_LIST, node->body.statements, 0);
+            }
+            break;
+        case AST_NODE_IF:
+            if(!err && node->if_condition.bodies) {
+                err = push_body(&stack, GEN_LIST, node->if_condition.bodies, 0);
+            }
+            break;
+        case AST_NODE_WHILE:
+            if(!err) {
+                err = push_body(&stack, GEN_NODE, node->while_loop.body, 0);
+            }
+            break;
+        case AST_NODE_REPEAT:
+            if(!err) {
+                err = push_body(&stack, GEN_NODE, node->repeat_loop.body, 0);
+            }
+            break;
+        case AST_NODE_FOR:
+            // pushed in reverse, they are popped in the order of the declarations
+            if(!err && (push_body(&stack, GEN_NODE, node->for_loop.setup, 0) != E_OK ||
+                        push_body(&stack, GEN_NODE, node->for_loop.step, 0) != E_OK ||
+                        push_body(&stack, GEN_NODE, node->for_loop.condition, 0) != E_OK ||
+                        push_body(&stack, GEN_NODE, node->for_loop.iterator, 0) != E_OK)) {
+                err = E_INT;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if(err) {
+        fprintf(stderr, "error: not enough memory\n");
     }
+    gen_stack_free(&stack);
 }
 
 void generate_reads()
@@ -2371,6 +2556,7 @@ void process_node_program(ast_node_t *cur_node)
 
 void avengers_assembler(ast_node_t *ast)
 {
+    atom_write = atom_intern_cstr("write");
     generate_header();
     process_node_program(ast);
 }
@@ -21,24 +21,27 @@
 #include <stdio.h>
 #include <locale.h>
 
+#include "atom.h"
 #include "scanner.h"
 #include "parser.h"
 #include "semantics.h"
 #include "codegen.h"
 #include "optimizations.h"
+#include "symtable.h"
 
 int main()
 {
     setlocale(LC_NUMERIC, "C");
-    scanner_init(stdin);
-
-    if(semantics_init()) {
-        fprintf(stderr, "internal error: couldn't init symtable\n");
+    if(scanner_init(stdin)) {
+        fprintf(stderr, "internal error: couldn't read source\n");
+        scanner_free();
         return E_INT;
     }
 
-    if(parser_init()) {
-        fprintf(stderr, "internal error: couldn't init parser\n");
+    scanner_lex_ahead();
+
+    if(semantics_init()) {
+        fprintf(stderr, "internal error: couldn't init symtable\n");
         return E_INT;
     }
 
@@ -53,10 +56,16 @@ int main()
         avengers_assembler(ast);
     }
 
-    free_ast(ast);
-    parser_free();
+#ifdef DBG
+    pool_stats_t stats = symtable_pool_stats();
+    fprintf(stderr, "symtable bindings: %zu live, %zu peak, %zu slabs\n", stats.live, stats.peak,
+            stats.slabs);
+#endif
+
+    ast_free();
     semantics_free();
     scanner_free();
+    atom_table_free();
 
     return result;
 }
@@ -22,7 +22,7 @@
 #include <limits.h>
 
 #include "error.h"
-#include "deque.h"
+#include "typed_stack.h"
 
 #ifdef DBG
 
@@ -399,7 +399,7 @@ int get_literal_number(ast_node_t *node, double *dest)
     }
 }
 
-int get_literal_string(ast_node_t *node, string_t *dest)
+int get_literal_string(ast_node_t *node, ast_string_t *dest)
 {
 
     switch(node->node_type) {
@@ -565,28 +565,26 @@ int try_binop_optimalization(ast_node_t *lnode, ast_node_t *rnode, type_t left,
         }
     } break;
     case TYPE_STRING: {
-        string_t lhs;
+        ast_string_t lhs;
         r = get_literal_string(lnode, &lhs);
         if(r != E_OK) {
             return E_INT_S;
         }
-        string_t rhs;
+        ast_string_t rhs;
         r = get_literal_string(rnode, &rhs);
         if(r != E_OK) {
             return E_INT_S;
         }
-        for(char *c = rhs.ptr; c && *c != '\0'; ++c) {
-            int r = str_append_char(&lhs, *c);
-            if(r != E_OK) {
-                str_free(&lhs);
-                str_free(&rhs);
-                break;
-            }
+        // operands may be shared with constant declarations, concatenate into a new string
+        char *result = ast_alloc(lhs.length + rhs.length + 1);
+        if(!result) {
+            return E_INT;
         }
-
-        str_free(&rhs);
+        memcpy(result, lhs.ptr, lhs.length);
+        memcpy(result + lhs.length, rhs.ptr, rhs.length);
         (*out)->node_type = AST_NODE_STRING;
-        (*out)->string = lhs;
+        (*out)->string.ptr = result;
+        (*out)->string.length = lhs.length + rhs.length;
     } break;
     case TYPE_BOOL: {
         (*out)->node_type = AST_NODE_BOOLEAN;
@@ -686,12 +684,12 @@ int try_binop_optimalization(ast_node_t *lnode, ast_node_t *rnode, type_t left,
                 return E_INT_S;
             }
         } else if(left == TYPE_STRING && right == TYPE_STRING) {
-            string_t lhs;
+            ast_string_t lhs;
             r = get_literal_string(lnode, &lhs);
             if(r != E_OK) {
                 return E_INT_S;
             }
-            string_t rhs;
+            ast_string_t rhs;
             r = get_literal_string(rnode, &rhs);
             if(r != E_OK) {
                 return E_INT_S;
@@ -746,14 +744,13 @@ int try_unop_optimalization(ast_node_t *operand, type_t optype, type_t *type, as
     case AST_NODE_UNOP_LEN: {
         switch(optype) {
         case TYPE_STRING: {
-            string_t str;
+            ast_string_t str;
             r = get_literal_string(operand, &str);
             if(r != E_OK) {
                 return E_INT_S;
             }
 
             int64_t len = str.length;
-            str_free(&str);
             (*out)->node_type = AST_NODE_INTEGER;
             (*out)->integer = len;
         } break;
@@ -832,9 +829,7 @@ int opt_unop_node(ast_node_t **node, type_t *type, bool is_cond)
         *type = old.metadata.result;
 
         int try = try_unop_optimalization(operand, optype, type, node);
-        if(try == E_OK) {
-            free(operand); // ast_free todo
-        } else {
+        if(try != E_OK) {
             // failed to optimalize, but we can continue
             PRINT(4, "Unop node: graceful reset\n");
             (*node)->node_type = AST_NODE_UNOP;
@@ -852,10 +847,89 @@ int opt_unop_node(ast_node_t **node, type_t *type, bool is_cond)
     return r;
 }
 
+/**
+ * Gets the string a constant operand stands for, a literal or a propagated constant.
+ *
+ * @return pointer to the string owned by the AST, NULL if operand isn't a constant string
+ */
+static const ast_string_t *constant_string(ast_node_t *node)
+{
+    if(node->node_type == AST_NODE_SYMBOL && !node->symbol.dirty && is_constant(node)) {
+        node = node->symbol.declaration->expr;
+    }
+    if(!node || node->node_type != AST_NODE_STRING) {
+        return NULL;
+    }
+    return &node->string;
+}
+
+/**
+ * Folds a chain of concatenations of constant strings at once.
+ *
+ * `..` is right associative, so folding pair by pair would copy the folded suffix again for every
+ * operand in front of it. The chain is measured first, the builder reserves the whole length and
+ * each operand is appended once. Short results stay in the inline buffer of the builder.
+ *
+ * @return E_OK if folded, E_INT_S if some operand isn't a constant string, E_INT on malloc error
+ */
+static int fold_concat_chain(ast_node_t **node)
+{
+    size_t length = 0;
+    ast_node_t *it = *node;
+    while(true) {
+        bool concat = it->node_type == AST_NODE_BINOP && it->binop.type == AST_NODE_BINOP_CONCAT;
+        const ast_string_t *str = constant_string(concat ? it->binop.left : it);
+        if(!str) {
+            return E_INT_S;
+        }
+        length += str->length;
+        if(!concat) {
+            break;
+        }
+        it = it->binop.right;
+    }
+
+    string_t result;
+    if(str_create_empty(&result) || str_reserve(&result, length)) {
+        return E_INT;
+    }
+    it = *node;
+    while(true) {
+        bool concat = it->node_type == AST_NODE_BINOP && it->binop.type == AST_NODE_BINOP_CONCAT;
+        const ast_string_t *str = constant_string(concat ? it->binop.left : it);
+        str_view_t view = { str->ptr, str->length };
+        // can't fail, the length is reserved
+        str_append_view(&result, view);
+        if(!concat) {
+            break;
+        }
+        it = it->binop.right;
+    }
+
+    PRINT(3, "Concatenation chain folded\n");
+    ast_string_t folded;
+    int r = ast_alloc_string(result.ptr, result.length, &folded);
+    str_free(&result);
+    if(r != E_OK) {
+        return r;
+    }
+    (*node)->node_type = AST_NODE_STRING;
+    (*node)->string = folded;
+    return E_OK;
+}
+
 int opt_binop_node(ast_node_t **node, type_t *type, bool is_cond)
 {
     int r;
 
+    if((*node)->binop.type == AST_NODE_BINOP_CONCAT) {
+        r = fold_concat_chain(node);
+        if(r != E_INT_S) {
+            *type = TYPE_STRING;
+            return r;
+        }
+    }
+
     type_t left;
     r = temp_check_expression(&(*node)->binop.left, &left, is_cond);
     if(r != E_OK) {
@@ -882,10 +956,7 @@ int opt_binop_node(ast_node_t **node, type_t *type, bool is_cond)
 
         int try = try_binop_optimalization(lnode, rnode, left, right, *type, node);
 
-        if(try == E_OK) {
-            free(lnode); // ast_free todo
-            free(rnode); // ast_free todo
-        } else {
+        if(try != E_OK) {
             // failed to optimalize, but we can continue
             PRINT(4, "Binop node: graceful reset\n");
             (*node)->node_type = AST_NODE_BINOP;
@@ -921,7 +992,7 @@ static int opt_func_call(ast_node_t **node, type_t *type, bool is_cond)
 
 static int opt_symbol(ast_node_t **node, type_t *type, bool is_cond)
 {
-    PRINT(3, "  on symbol: %s\n", (*node)->symbol.declaration->name.ptr);
+    PRINT(3, "  on symbol: %s\n", (*node)->symbol.declaration->name->str);
     (void) is_cond;
     bool dec = true;
     //    if(scopes[current_scope].is_cycle) {
@@ -941,17 +1012,13 @@ static int opt_symbol(ast_node_t **node, type_t *type, bool is_cond)
 
         ast_node_t *expr = (*node)->symbol.declaration->expr;
         if(expr) {
-            // should be freed
-
             ast_node_t *next = (*node)->next;
             switch(expr->node_type) {
-            case AST_NODE_STRING: {
-                string_t cpy;
-                if(str_create(expr->string.ptr, &cpy) == E_OK) {
-                    (*node)->node_type = AST_NODE_STRING;
-                    (*node)->string = cpy;
-                }
-            } break;
+            case AST_NODE_STRING:
+                // strings are immutable and owned by the AST, they can be shared
+                (*node)->node_type = AST_NODE_STRING;
+                (*node)->string = expr->string;
+                break;
             case AST_NODE_INTEGER:
                 (*node)->node_type = AST_NODE_INTEGER;
                 (*node)->integer = expr->integer;
@@ -1053,84 +1120,52 @@ static int iterate_list(ast_node_list_t list, ast_callback callback)
     return E_OK;
 }
 
-static void free_node_content(ast_node_t *node)
+/**
+ * @brief Step of the first pass, a frame of its explicit statement stack.
+ *
+ * Bodies are pushed instead of recursed into, so nesting depth of the program doesn't nest calls.
+ */
+typedef enum
 {
-    if(!node) {
-        return;
-    }
-    switch(node->node_type) {
-    case AST_NODE_PROGRAM:
-        str_free(&node->program.require);
-        free_ast(node->program.global_statement_list);
-        break;
-    case AST_NODE_FUNC_DECL:
-        str_free(&node->func_decl.name);
-        free_ast(node->func_decl.argument_types);
-        free_ast(node->func_decl.return_types);
-        break;
-    case AST_NODE_FUNC_DEF:
-        str_free(&node->func_def.name);
-        free_ast(node->func_def.arguments);
-        free_ast(node->func_def.return_types);
-        free_ast(node->func_def.body);
-        break;
-    case AST_NODE_FUNC_CALL:
-        str_free(&node->func_call.name);
-        free_ast(node->func_call.arguments);
-        break;
-    case AST_NODE_DECLARATION:
-        if(node->symbol.is_declaration) {
-            str_free(&node->symbol.name);
-        }
-        free_ast(node->declaration.assignment);
-        break;
-    case AST_NODE_ASSIGNMENT:
-        free_ast(node->assignment.identifiers);
-        free_ast(node->assignment.expressions);
-        break;
-    case AST_NODE_BODY:
-        free_ast(node->body.statements);
-        break;
-    case AST_NODE_IF:
-        free_ast(node->if_condition.conditions);
-        free_ast(node->if_condition.bodies);
-        break;
-    case AST_NODE_WHILE:
-        free_ast(node->while_loop.condition);
-        free_ast(node->while_loop.body);
-        break;
-    case AST_NODE_REPEAT:
-        free_ast(node->repeat_loop.condition);
-        free_ast(node->repeat_loop.body);
-        break;
-    case AST_NODE_FOR:
-        free_ast(node->for_loop.iterator);
-        free_ast(node->for_loop.setup);
-        free_ast(node->for_loop.condition);
-        free_ast(node->for_loop.step);
-        free_ast(node->for_loop.body);
-        break;
-    case AST_NODE_RETURN:
-        free_ast(node->return_values.values);
-        break;
-    case AST_NODE_SYMBOL:
-        if(node->symbol.is_declaration) {
-            str_free(&node->symbol.name);
-        }
-        break;
-    case AST_NODE_STRING:
-        str_free(&node->string);
-        break;
-    case AST_NODE_BINOP:
-        free_ast(node->binop.left);
-        free_ast(node->binop.right);
-        break;
-    case AST_NODE_UNOP:
-        free_ast(node->unop.operand);
-        break;
-    default:
-        break;
+    OPT_NODE,      ///< optimize node
+    OPT_LIST,      ///< optimize node and the statements following it
+    OPT_NEXT,      ///< continue with the statement following node
+    OPT_IF_BRANCH, ///< optimize the remaining branches of the if node
+    OPT_POP_SCOPE, ///< leave the scope of a finished body
+} opt_step_t;
+
+typedef struct {
+    opt_step_t step;
+    ast_node_t *node;
+    ast_node_t *cond;      ///< condition of the next branch of OPT_IF_BRANCH
+    ast_node_t *body;      ///< body of the next branch of OPT_IF_BRANCH
+    ast_node_t *prev_cond; ///< last kept condition of OPT_IF_BRANCH
+    ast_node_t *prev_body;
+} opt_frame_t;
+
+DEFINE_STACK(opt_stack, opt_frame_t)
+
+/// frames on the C stack, nesting deeper than that moves them to the heap
+#define OPT_STACK_INLINE_LENGTH 32
+
+static int push_frame(opt_stack_t *stack, opt_step_t step, ast_node_t *node)
+{
+    opt_frame_t frame = { .step = step, .node = node };
+    return opt_stack_push(stack, frame);
+}
+
+/**
+ * @brief Enters a new scope and pushes body, the scope is left once body is optimized.
+ *
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+static int push_body(opt_stack_t *stack, ast_node_t *body, bool is_cycle)
+{
+    if(push_frame(stack, OPT_POP_SCOPE, NULL) != E_OK) {
+        return E_INT;
     }
+    push_scope(is_cycle);
+    return push_frame(stack, OPT_NODE, body);
 }
 
 static void invalidate_node(ast_node_t *node)
@@ -1138,38 +1173,31 @@ static void invalidate_node(ast_node_t *node)
     if(!node) {
         return;
     }
-    ast_node_t *next = node->next;
-    free_node_content(node);
     node->node_type = AST_NODE_INVALID;
-    node->next = next;
 }
 
-static int opt_func_def(ast_node_t **node, ast_callback callback)
+static int opt_func_def(opt_stack_t *stack, ast_node_t **node)
 {
     if(!is_function_used(&(*node)->func_def)) {
-        PRINT(3, "DEC: Func def: %s\n", (*node)->func_def.name.ptr);
+        PRINT(3, "DEC: Func def: %s\n", (*node)->func_def.name->str);
         invalidate_node(*node);
 
         return E_OK;
     }
-    push_scope(false);
     PRINT(3, "func def start\n");
-    int r = callback(&(*node)->func_def.body);
-    PRINT(3, "func def end\n");
-    pop_scope();
-    return r;
+    return push_body(stack, (*node)->func_def.body, false);
 }
 
 static int opt_declaration(ast_node_t **node)
 {
     if(!(*node)->declaration.symbol.used) {
-        PRINT(3, "DEC: Declaration: %s\n", (*node)->declaration.symbol.name.ptr);
+        PRINT(3, "DEC: Declaration: %s\n", (*node)->declaration.symbol.name->str);
         invalidate_node(*node);
         return E_OK;
     }
 
     if((*node)->declaration.symbol.current_read == 0) {
-        PRINT(3, "DEC: value of %s not used\n", (*node)->declaration.symbol.name.ptr);
+        PRINT(3, "DEC: value of %s not used\n", (*node)->declaration.symbol.name->str);
         invalidate_node((*node)->declaration.assignment);
         (*node)->declaration.assignment = NULL;
     }
@@ -1205,14 +1233,18 @@ static bool is_condition_const_false(ast_node_t *node)
     }
 }
 
-static int opt_if(ast_node_t **node)
+/**
+ * @brief Optimizes conditions of the if in frame up to the next kept branch and pushes its body.
+ *
+ * @return E_INT on allocation error, otherwise result of the expression checks
+ */
+static int opt_if_branch(opt_stack_t *stack, opt_frame_t *frame)
 {
-
-    PRINT(3, "on if\n");
-    ast_node_t *cond = (*node)->if_condition.conditions;
-    ast_node_t *body = (*node)->if_condition.bodies;
-    ast_node_t *prev_cond = NULL;
-    ast_node_t *prev_body = NULL;
+    ast_node_t **node = &frame->node;
+    ast_node_t *cond = frame->cond;
+    ast_node_t *body = frame->body;
+    ast_node_t *prev_cond = frame->prev_cond;
+    ast_node_t *prev_body = frame->prev_body;
     while(cond && body) {
 
         PRINT(3, "  on condition\n");
@@ -1234,16 +1266,8 @@ static int opt_if(ast_node_t **node)
                 prev_body->next = body->next;
             }
 
-            ast_node_t *tempcond = cond;
-            ast_node_t *tempbody = body;
-
             cond = cond->next;
             body = body->next;
-
-            free_node_content(tempcond);
-            free(tempcond);
-            free_node_content(tempbody);
-            free(tempbody);
         } else if(is_condition_const_true(cond)) {
             PRINT(3, " DEC: if branch is always true\n");
             if(!prev_cond) {
@@ -1251,26 +1275,27 @@ static int opt_if(ast_node_t **node)
             } else {
                 prev_cond->next = NULL;
             }
-            free_ast(cond);
-            free_ast(body->next);
             body->next = NULL;
-            push_scope(false);
-            r = first_pass(&body);
-            pop_scope();
-            if(r != E_OK) {
-                return r;
+
+            // the following branches were cut off, only this body remains
+            opt_frame_t next = { .step = OPT_IF_BRANCH, .node = *node };
+            if(opt_stack_push(stack, next) != E_OK) {
+                return E_INT;
             }
+            return push_body(stack, body, false);
         } else {
-            push_scope(false);
-            r = first_pass(&body);
-            pop_scope();
-            if(r != E_OK) {
-                return r;
+            opt_frame_t next = {
+                .step = OPT_IF_BRANCH,
+                .node = *node,
+                .cond = cond->next,
+                .body = body->next,
+                .prev_cond = cond,
+                .prev_body = body,
+            };
+            if(opt_stack_push(stack, next) != E_OK) {
+                return E_INT;
             }
-            prev_cond = cond;
-            prev_body = body;
-            cond = cond->next;
-            body = body->next;
+            return push_body(stack, body, false);
         }
     }
 
@@ -1286,7 +1311,20 @@ static int opt_if(ast_node_t **node)
     return E_OK;
 }
 
-static int opt_while(ast_node_t **node)
+static int opt_if(opt_stack_t *stack, ast_node_t **node)
+{
+
+    PRINT(3, "on if\n");
+    opt_frame_t frame = {
+        .step = OPT_IF_BRANCH,
+        .node = *node,
+        .cond = (*node)->if_condition.conditions,
+        .body = (*node)->if_condition.bodies,
+    };
+    return opt_if_branch(stack, &frame);
+}
+
+static int opt_while(opt_stack_t *stack, ast_node_t **node)
 {
     PRINT(3, "on while\n");
 
@@ -1304,13 +1342,10 @@ static int opt_while(ast_node_t **node)
         PRINT(5, "Warning: loop condition is always true.\n");
     }
 
-    push_scope(true);
-    r = first_pass(&(*node)->while_loop.body);
-    pop_scope();
-    return r;
+    return push_body(stack, (*node)->while_loop.body, true);
 }
 
-static int opt_for(ast_node_t **node)
+static int opt_for(opt_stack_t *stack, ast_node_t **node)
 {
     int r = E_OK;
     r = first_pass_condition(&(*node)->for_loop.condition->declaration.assignment);
@@ -1331,13 +1366,10 @@ static int opt_for(ast_node_t **node)
     }
     gen_usage_for();
 
-    push_scope(true);
-    r = first_pass(&(*node)->for_loop.body);
-    pop_scope();
-    return r;
+    return push_body(stack, (*node)->for_loop.body, true);
 }
 
-static int opt_repeat(ast_node_t **node)
+static int opt_repeat(opt_stack_t *stack, ast_node_t **node)
 {
     int r = E_OK;
     first_pass_condition(&(*node)->repeat_loop.condition);
@@ -1345,10 +1377,7 @@ static int opt_repeat(ast_node_t **node)
         return r;
     }
 
-    push_scope(true);
-    r = first_pass(&(*node)->repeat_loop.body);
-    pop_scope();
-    return r;
+    return push_body(stack, (*node)->repeat_loop.body, true);
 }
 
 static int opt_assignment(ast_node_t **node)
@@ -1392,7 +1421,7 @@ static int opt_assignment(ast_node_t **node)
         ast_node_t *prev_exp = NULL;
         while(ids && exp) {
             if(ids->symbol.current_read == 0) {
-                PRINT(3, "  var %s is not used.\n", ids->symbol.declaration->name.ptr);
+                PRINT(3, "  var %s is not used.\n", ids->symbol.declaration->name->str);
 
                 if(!prev_ids) {
                     (*node)->assignment.identifiers = ids->next;
@@ -1404,12 +1433,8 @@ static int opt_assignment(ast_node_t **node)
                 } else {
                     prev_exp->next = exp->next;
                 }
-                ast_node_t *temp_ids = ids;
-                ast_node_t *temp_exp = exp;
                 ids = ids->next;
                 exp = exp->next;
-                free_ast(temp_ids);
-                free_ast(temp_exp);
             } else {
                 prev_ids = ids;
                 prev_exp = exp;
@@ -1428,7 +1453,10 @@ static int fp_opt_func_call(ast_node_t **node)
     return opt_func_call(node, &type, false);
 }
 
-static int first_pass(ast_node_t **node)
+/**
+ * @brief Optimizes node, statements in it are pushed to stack.
+ */
+static int opt_node(opt_stack_t *stack, ast_node_t **node)
 {
     int r = E_OK;
     if(!*node) {
@@ -1436,31 +1464,70 @@ static int first_pass(ast_node_t **node)
     }
     switch((*node)->node_type) {
     case AST_NODE_PROGRAM:
-        return iterate_list((*node)->program.global_statement_list, first_pass);
+        return push_frame(stack, OPT_LIST, (*node)->program.global_statement_list);
     case AST_NODE_FUNC_DEF:
-        return opt_func_def(node, first_pass);
+        return opt_func_def(stack, node);
     case AST_NODE_BODY:
-        return iterate_list((*node)->body.statements, first_pass);
+        return push_frame(stack, OPT_LIST, (*node)->body.statements);
     case AST_NODE_ASSIGNMENT:
         return opt_assignment(node);
     case AST_NODE_DECLARATION:
         return opt_declaration(node);
     case AST_NODE_IF:
-        return opt_if(node);
+        return opt_if(stack, node);
     case AST_NODE_WHILE:
-        return opt_while(node);
+        return opt_while(stack, node);
     case AST_NODE_FOR:
-        return opt_for(node);
+        return opt_for(stack, node);
     case AST_NODE_FUNC_CALL:
         return fp_opt_func_call(node);
     case AST_NODE_REPEAT:
-        return opt_repeat(node);
+        return opt_repeat(stack, node);
     default:
         break;
     }
     return r;
 }
 
+static int first_pass(ast_node_t **node)
+{
+    opt_frame_t buffer[OPT_STACK_INLINE_LENGTH];
+    opt_stack_t stack;
+    opt_stack_create_buffer(&stack, buffer, OPT_STACK_INLINE_LENGTH);
+
+    int r = push_frame(&stack, OPT_NODE, *node);
+    while(r == E_OK && !opt_stack_empty(&stack)) {
+        opt_frame_t frame = opt_stack_pop(&stack);
+        switch(frame.step) {
+        case OPT_NODE:
+            r = opt_node(&stack, &frame.node);
+            break;
+        case OPT_LIST:
+            if(!frame.node) {
+                break;
+            }
+            // the following statement is looked up once this one is done
+            r = push_frame(&stack, OPT_NEXT, frame.node);
+            if(r == E_OK) {
+                r = opt_node(&stack, &frame.node);
+            }
+            break;
+        case OPT_NEXT:
+            r = push_frame(&stack, OPT_LIST, frame.node->next);
+            break;
+        case OPT_IF_BRANCH:
+            r = opt_if_branch(&stack, &frame);
+            break;
+        case OPT_POP_SCOPE:
+            pop_scope();
+            break;
+        }
+    }
+
+    opt_stack_free(&stack);
+    return r;
+}
+
 bool is_function_used(ast_func_def_t *def)
 {
     bool used = def->used;
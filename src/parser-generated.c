@@ -21,26 +21,7 @@
 #include <stdbool.h>
 
 #include "parser-generated.h"
-#include "error.h"
 
-parser_table_t *table;
-
-static struct {
-    void *data;
-    size_t size;
-    size_t offset;
-} mempool;
-
-static void *alloc_tokens(size_t n_tokens)
-{
-    void *ret = (uint8_t *) mempool.data + mempool.offset;
-    mempool.offset += n_tokens * sizeof(nut_type_t);
-    return ret;
-}
-size_t parser_get_table_index(nterm_type_t nterm, term_type_t term)
-{
-    return ((nterm << 6) + term) % 1261;
-}
 const char *nterm_to_readable(nterm_type_t nterm)
 {
     switch(nterm) {
@@ -231,854 +212,553 @@ const char *term_to_readable(term_type_t term)
     }
     return "<unknown-term>";
 }
-int parser_init()
-{
-    mempool.offset = 0;
-    mempool.data = calloc(317, sizeof(nut_type_t));
-    if(mempool.data == NULL) {
-        return E_INT;
-    }
-    mempool.size = 317 * sizeof(nut_type_t);
 
-    size_t rule_count = 1261;
-    table = calloc(1, sizeof(parser_table_t) + rule_count * sizeof(exp_list_t));
-    if(table == NULL) {
-        return E_INT;
-    }
+const nut_type_t parser_rules[171] = {
+    { .term = T_FOR },
+    { .term = T_IDENTIFIER },
+    { .term = T_EQUALS },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_OPTIONAL_FOR_STEP },
+    { .term = T_DO },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .term = T_END },
+    { .term = T_IDENTIFIER },
+    { .term = T_LPAREN },
+    { .is_nterm = true, .nterm = NT_OPTIONAL_FUN_EXPRESSION_LIST },
+    { .term = T_RPAREN },
+    { .term = T_MINUS },
+    { .term = T_NOT },
+    { .term = T_HASH },
+    { .term = T_COLON },
+    { .term = T_TYPE },
+    { .is_nterm = true, .nterm = NT_FUNC_TYPE_LIST2 },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_WITH_TYPE },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST_WITH_TYPES2 },
+    { .is_nterm = true, .nterm = NT_FUNC_CALL },
+    { .is_nterm = true, .nterm = NT_FUNC_DEF },
+    { .is_nterm = true, .nterm = NT_FUNC_DECL },
+    { .term = T_COMMA },
+    { .term = T_TYPE },
+    { .is_nterm = true, .nterm = NT_TYPE_LIST2 },
+    { .term = T_ELSE },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .term = T_END },
+    { .term = T_ELSEIF },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_THEN },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .is_nterm = true, .nterm = NT_COND_OPT_ELSEIF },
+    { .term = T_END },
+    { .is_nterm = true, .nterm = NT_RETURN_STATEMENT },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_WITH_TYPE },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST_WITH_TYPES2 },
+    { .is_nterm = true, .nterm = NT_FOR_LOOP },
+    { .term = T_BREAK },
+    { .term = T_IDENTIFIER },
+    { .is_nterm = true, .nterm = NT_PAREN_EXP_LIST_OR_ID_LIST2 },
+    { .is_nterm = true, .nterm = NT_DECLARATION },
+    { .is_nterm = true, .nterm = NT_WHILE_LOOP },
+    { .is_nterm = true, .nterm = NT_REPEAT_UNTIL },
+    { .is_nterm = true, .nterm = NT_COND_STATEMENT },
+    { .term = T_GLOBAL },
+    { .term = T_IDENTIFIER },
+    { .term = T_COLON },
+    { .term = T_FUNCTION },
+    { .term = T_LPAREN },
+    { .is_nterm = true, .nterm = NT_TYPE_LIST },
+    { .term = T_RPAREN },
+    { .is_nterm = true, .nterm = NT_FUNC_TYPE_LIST },
+    { .term = T_FUNCTION },
+    { .term = T_IDENTIFIER },
+    { .term = T_LPAREN },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST_WITH_TYPES },
+    { .term = T_RPAREN },
+    { .is_nterm = true, .nterm = NT_FUNC_TYPE_LIST },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .term = T_END },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_FUN_EXPRESSION_LIST2 },
+    { .term = T_COMMA },
+    { .term = T_IDENTIFIER },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST2 },
+    { .term = T_LPAREN },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_RPAREN },
+    { .term = T_STRING },
+    { .term = T_IDENTIFIER },
+    { .is_nterm = true, .nterm = NT_OPTIONAL_FUN_PARENS },
+    { .term = T_NUMBER },
+    { .term = T_NIL },
+    { .term = T_BOOL },
+    { .term = T_INTEGER },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_LPAREN },
+    { .is_nterm = true, .nterm = NT_OPTIONAL_FUN_EXPRESSION_LIST },
+    { .term = T_RPAREN },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST2 },
+    { .term = T_EQUALS },
+    { .is_nterm = true, .nterm = NT_EXPRESSION_LIST },
+    { .term = T_IDENTIFIER },
+    { .term = T_COLON },
+    { .term = T_TYPE },
+    { .term = T_WHILE },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_DO },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .term = T_END },
+    { .term = T_RETURN },
+    { .is_nterm = true, .nterm = NT_RET_EXPRESSION_LIST },
+    { .is_nterm = true, .nterm = NT_TERM },
+    { .is_nterm = true, .nterm = NT_OPT_BINOP },
+    { .is_nterm = true, .nterm = NT_UNOP },
+    { .is_nterm = true, .nterm = NT_TERM },
+    { .is_nterm = true, .nterm = NT_OPT_BINOP },
+    { .term = T_TYPE },
+    { .is_nterm = true, .nterm = NT_TYPE_LIST2 },
+    { .term = T_EQUALS },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_FUN_EXPRESSION_LIST2 },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_RET_EXPRESSION_LIST2 },
+    { .term = T_REPEAT },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .term = T_UNTIL },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_LTE },
+    { .term = T_GTE },
+    { .term = T_TILDE_EQUALS },
+    { .term = T_COLON },
+    { .term = T_OR },
+    { .term = T_DOUBLE_SLASH },
+    { .term = T_DOUBLE_EQUALS },
+    { .term = T_AND },
+    { .term = T_SLASH },
+    { .term = T_PERCENT },
+    { .term = T_LT },
+    { .term = T_ASTERISK },
+    { .term = T_PLUS },
+    { .term = T_GT },
+    { .term = T_DOUBLE_DOT },
+    { .term = T_CARET },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_EXPRESSION_LIST2 },
+    { .is_nterm = true, .nterm = NT_STATEMENT },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST2 },
+    { .is_nterm = true, .nterm = NT_OPT_RETURN_STATEMENT },
+    { .is_nterm = true, .nterm = NT_OPT_RETURN_STATEMENT },
+    { .term = T_COMMA },
+    { .term = T_TYPE },
+    { .is_nterm = true, .nterm = NT_FUNC_TYPE_LIST2 },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST },
+    { .term = T_EQUALS },
+    { .is_nterm = true, .nterm = NT_EXPRESSION_LIST },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_EXPRESSION_LIST2 },
+    { .term = T_COMMA },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .is_nterm = true, .nterm = NT_RET_EXPRESSION_LIST2 },
+    { .term = T_REQUIRE },
+    { .term = T_STRING },
+    { .is_nterm = true, .nterm = NT_GLOBAL_STATEMENT_LIST },
+    { .term = T_IF },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_THEN },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST },
+    { .is_nterm = true, .nterm = NT_COND_OPT_ELSEIF },
+    { .is_nterm = true, .nterm = NT_STATEMENT },
+    { .is_nterm = true, .nterm = NT_STATEMENT_LIST2 },
+    { .is_nterm = true, .nterm = NT_BINOP },
+    { .is_nterm = true, .nterm = NT_EXPRESSION },
+    { .term = T_LOCAL },
+    { .term = T_IDENTIFIER },
+    { .term = T_COLON },
+    { .term = T_TYPE },
+    { .is_nterm = true, .nterm = NT_DECL_OPTIONAL_ASSIGNMENT },
+    { .term = T_IDENTIFIER },
+    { .is_nterm = true, .nterm = NT_IDENTIFIER_LIST2 },
+    { .is_nterm = true, .nterm = NT_GLOBAL_STATEMENT },
+    { .is_nterm = true, .nterm = NT_GLOBAL_STATEMENT_LIST },
+};
 
-    table->bucket_count = rule_count;
-    table->data[1006] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[1006].data[0].term = T_REQUIRE;
-    table->data[1006].data[1].term = T_STRING;
-    table->data[1006].data[2].is_nterm = true;
-    table->data[1006].data[2].nterm = NT_GLOBAL_STATEMENT_LIST;
-    table->data[131] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[131].data[0].is_nterm = true;
-    table->data[131].data[0].nterm = NT_GLOBAL_STATEMENT;
-    table->data[131].data[1].is_nterm = true;
-    table->data[131].data[1].nterm = NT_GLOBAL_STATEMENT_LIST;
-    table->data[116] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[116].data[0].is_nterm = true;
-    table->data[116].data[0].nterm = NT_GLOBAL_STATEMENT;
-    table->data[116].data[1].is_nterm = true;
-    table->data[116].data[1].nterm = NT_GLOBAL_STATEMENT_LIST;
-    table->data[127] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[127].data[0].is_nterm = true;
-    table->data[127].data[0].nterm = NT_GLOBAL_STATEMENT;
-    table->data[127].data[1].is_nterm = true;
-    table->data[127].data[1].nterm = NT_GLOBAL_STATEMENT_LIST;
-    table->data[146] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[349] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[349].data[0].is_nterm = true;
-    table->data[349].data[0].nterm = NT_FUNC_DECL;
-    table->data[345] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[345].data[0].is_nterm = true;
-    table->data[345].data[0].nterm = NT_FUNC_DEF;
-    table->data[334] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[334].data[0].is_nterm = true;
-    table->data[334].data[0].nterm = NT_FUNC_CALL;
-    table->data[733] = (exp_list_t){ .valid = true, .size = 8, .data = alloc_tokens(8) };
-    table->data[733].data[0].term = T_GLOBAL;
-    table->data[733].data[1].term = T_IDENTIFIER;
-    table->data[733].data[2].term = T_COLON;
-    table->data[733].data[3].term = T_FUNCTION;
-    table->data[733].data[4].term = T_LPAREN;
-    table->data[733].data[5].is_nterm = true;
-    table->data[733].data[5].nterm = NT_TYPE_LIST;
-    table->data[733].data[6].term = T_RPAREN;
-    table->data[733].data[7].is_nterm = true;
-    table->data[733].data[7].nterm = NT_FUNC_TYPE_LIST;
-    table->data[232] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[232].data[0].term = T_TYPE;
-    table->data[232].data[1].is_nterm = true;
-    table->data[232].data[1].nterm = NT_TYPE_LIST2;
-    table->data[226] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[255] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[404] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[404].data[0].term = T_COMMA;
-    table->data[404].data[1].term = T_TYPE;
-    table->data[404].data[2].is_nterm = true;
-    table->data[404].data[2].nterm = NT_TYPE_LIST2;
-    table->data[399] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[428] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[793] = (exp_list_t){ .valid = true, .size = 8, .data = alloc_tokens(8) };
-    table->data[793].data[0].term = T_FUNCTION;
-    table->data[793].data[1].term = T_IDENTIFIER;
-    table->data[793].data[2].term = T_LPAREN;
-    table->data[793].data[3].is_nterm = true;
-    table->data[793].data[3].nterm = NT_IDENTIFIER_LIST_WITH_TYPES;
-    table->data[793].data[4].term = T_RPAREN;
-    table->data[793].data[5].is_nterm = true;
-    table->data[793].data[5].nterm = NT_FUNC_TYPE_LIST;
-    table->data[793].data[6].is_nterm = true;
-    table->data[793].data[6].nterm = NT_STATEMENT_LIST;
-    table->data[793].data[7].term = T_END;
-    table->data[270] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[270].data[0].is_nterm = true;
-    table->data[270].data[0].nterm = NT_IDENTIFIER_WITH_TYPE;
-    table->data[270].data[1].is_nterm = true;
-    table->data[270].data[1].nterm = NT_IDENTIFIER_LIST_WITH_TYPES2;
-    table->data[271] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[300] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[596] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[596].data[0].term = T_COMMA;
-    table->data[596].data[1].is_nterm = true;
-    table->data[596].data[1].nterm = NT_IDENTIFIER_WITH_TYPE;
-    table->data[596].data[2].is_nterm = true;
-    table->data[596].data[2].nterm = NT_IDENTIFIER_LIST_WITH_TYPES2;
-    table->data[591] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[620] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[199] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[199].data[0].term = T_COLON;
-    table->data[199].data[1].term = T_TYPE;
-    table->data[199].data[2].is_nterm = true;
-    table->data[199].data[2].nterm = NT_FUNC_TYPE_LIST2;
-    table->data[217] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[231] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[224] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[233] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[236] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[221] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[238] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[206] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[192] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[208] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[205] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[218] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[743] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[743].data[0].term = T_COMMA;
-    table->data[743].data[1].term = T_TYPE;
-    table->data[743].data[2].is_nterm = true;
-    table->data[743].data[2].nterm = NT_FUNC_TYPE_LIST2;
-    table->data[748] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[762] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[755] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[764] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[767] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[752] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[769] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[737] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[723] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[739] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[736] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[749] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[698] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[698].data[0].is_nterm = true;
-    table->data[698].data[0].nterm = NT_STATEMENT;
-    table->data[698].data[1].is_nterm = true;
-    table->data[698].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[698].data[2].is_nterm = true;
-    table->data[698].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[705] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[705].data[0].is_nterm = true;
-    table->data[705].data[0].nterm = NT_STATEMENT;
-    table->data[705].data[1].is_nterm = true;
-    table->data[705].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[705].data[2].is_nterm = true;
-    table->data[705].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[673] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[673].data[0].is_nterm = true;
-    table->data[673].data[0].nterm = NT_STATEMENT;
-    table->data[673].data[1].is_nterm = true;
-    table->data[673].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[673].data[2].is_nterm = true;
-    table->data[673].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[659] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[659].data[0].is_nterm = true;
-    table->data[659].data[0].nterm = NT_STATEMENT;
-    table->data[659].data[1].is_nterm = true;
-    table->data[659].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[659].data[2].is_nterm = true;
-    table->data[659].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[675] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[675].data[0].is_nterm = true;
-    table->data[675].data[0].nterm = NT_STATEMENT;
-    table->data[675].data[1].is_nterm = true;
-    table->data[675].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[675].data[2].is_nterm = true;
-    table->data[675].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[672] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[672].data[0].is_nterm = true;
-    table->data[672].data[0].nterm = NT_STATEMENT;
-    table->data[672].data[1].is_nterm = true;
-    table->data[672].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[672].data[2].is_nterm = true;
-    table->data[672].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[685] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[685].data[0].is_nterm = true;
-    table->data[685].data[0].nterm = NT_STATEMENT;
-    table->data[685].data[1].is_nterm = true;
-    table->data[685].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[685].data[2].is_nterm = true;
-    table->data[685].data[2].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[691] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[691].data[0].is_nterm = true;
-    table->data[691].data[0].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[677] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[670] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[700] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[661] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[703] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[703].data[0].is_nterm = true;
-    table->data[703].data[0].nterm = NT_OPT_RETURN_STATEMENT;
-    table->data[1146] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1146].data[0].is_nterm = true;
-    table->data[1146].data[0].nterm = NT_STATEMENT;
-    table->data[1146].data[1].is_nterm = true;
-    table->data[1146].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1153] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1153].data[0].is_nterm = true;
-    table->data[1153].data[0].nterm = NT_STATEMENT;
-    table->data[1153].data[1].is_nterm = true;
-    table->data[1153].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1121] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1121].data[0].is_nterm = true;
-    table->data[1121].data[0].nterm = NT_STATEMENT;
-    table->data[1121].data[1].is_nterm = true;
-    table->data[1121].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1107] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1107].data[0].is_nterm = true;
-    table->data[1107].data[0].nterm = NT_STATEMENT;
-    table->data[1107].data[1].is_nterm = true;
-    table->data[1107].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1123] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1123].data[0].is_nterm = true;
-    table->data[1123].data[0].nterm = NT_STATEMENT;
-    table->data[1123].data[1].is_nterm = true;
-    table->data[1123].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1120] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1120].data[0].is_nterm = true;
-    table->data[1120].data[0].nterm = NT_STATEMENT;
-    table->data[1120].data[1].is_nterm = true;
-    table->data[1120].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1133] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1133].data[0].is_nterm = true;
-    table->data[1133].data[0].nterm = NT_STATEMENT;
-    table->data[1133].data[1].is_nterm = true;
-    table->data[1133].data[1].nterm = NT_STATEMENT_LIST2;
-    table->data[1125] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1118] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1139] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1148] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1109] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1151] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[686] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[686].data[0].is_nterm = true;
-    table->data[686].data[0].nterm = NT_COND_STATEMENT;
-    table->data[666] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[666].data[0].is_nterm = true;
-    table->data[666].data[0].nterm = NT_WHILE_LOOP;
-    table->data[640] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[640].data[0].is_nterm = true;
-    table->data[640].data[0].nterm = NT_FOR_LOOP;
-    table->data[679] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[679].data[0].is_nterm = true;
-    table->data[679].data[0].nterm = NT_REPEAT_UNTIL;
-    table->data[656] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[656].data[0].is_nterm = true;
-    table->data[656].data[0].nterm = NT_DECLARATION;
-    table->data[654] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[654].data[0].term = T_IDENTIFIER;
-    table->data[654].data[1].is_nterm = true;
-    table->data[654].data[1].nterm = NT_PAREN_EXP_LIST_OR_ID_LIST2;
-    table->data[653] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[653].data[0].term = T_BREAK;
-    table->data[1091] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[1091].data[0].term = T_LPAREN;
-    table->data[1091].data[1].is_nterm = true;
-    table->data[1091].data[1].nterm = NT_OPTIONAL_FUN_EXPRESSION_LIST;
-    table->data[1091].data[2].term = T_RPAREN;
-    table->data[1108] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[1108].data[0].is_nterm = true;
-    table->data[1108].data[0].nterm = NT_IDENTIFIER_LIST2;
-    table->data[1108].data[1].term = T_EQUALS;
-    table->data[1108].data[2].is_nterm = true;
-    table->data[1108].data[2].nterm = NT_EXPRESSION_LIST;
-    table->data[1128] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[1128].data[0].is_nterm = true;
-    table->data[1128].data[0].nterm = NT_IDENTIFIER_LIST2;
-    table->data[1128].data[1].term = T_EQUALS;
-    table->data[1128].data[2].is_nterm = true;
-    table->data[1128].data[2].nterm = NT_EXPRESSION_LIST;
-    table->data[22] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[22].data[0].term = T_LPAREN;
-    table->data[22].data[1].is_nterm = true;
-    table->data[22].data[1].nterm = NT_OPTIONAL_FUN_EXPRESSION_LIST;
-    table->data[22].data[2].term = T_RPAREN;
-    table->data[23] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[62] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[51] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[42] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[49] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[32] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[31] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[47] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[29] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[28] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[24] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[25] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[50] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[54] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[56] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[30] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[33] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[39] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[26] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[20] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[41] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[34] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[65] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[35] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[36] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[37] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[45] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[58] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[60] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[21] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[19] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[43] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[64] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[63] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1089] = (exp_list_t){ .valid = true, .size = 5, .data = alloc_tokens(5) };
-    table->data[1089].data[0].term = T_IF;
-    table->data[1089].data[1].is_nterm = true;
-    table->data[1089].data[1].nterm = NT_EXPRESSION;
-    table->data[1089].data[2].term = T_THEN;
-    table->data[1089].data[3].is_nterm = true;
-    table->data[1089].data[3].nterm = NT_STATEMENT_LIST;
-    table->data[1089].data[4].is_nterm = true;
-    table->data[1089].data[4].nterm = NT_COND_OPT_ELSEIF;
-    table->data[459] = (exp_list_t){ .valid = true, .size = 5, .data = alloc_tokens(5) };
-    table->data[459].data[0].term = T_ELSEIF;
-    table->data[459].data[1].is_nterm = true;
-    table->data[459].data[1].nterm = NT_EXPRESSION;
-    table->data[459].data[2].term = T_THEN;
-    table->data[459].data[3].is_nterm = true;
-    table->data[459].data[3].nterm = NT_STATEMENT_LIST;
-    table->data[459].data[4].is_nterm = true;
-    table->data[459].data[4].nterm = NT_COND_OPT_ELSEIF;
-    table->data[450] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[450].data[0].term = T_ELSE;
-    table->data[450].data[1].is_nterm = true;
-    table->data[450].data[1].nterm = NT_STATEMENT_LIST;
-    table->data[450].data[2].term = T_END;
-    table->data[489] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[489].data[0].term = T_END;
-    table->data[1242] = (exp_list_t){ .valid = true, .size = 5, .data = alloc_tokens(5) };
-    table->data[1242].data[0].term = T_WHILE;
-    table->data[1242].data[1].is_nterm = true;
-    table->data[1242].data[1].nterm = NT_EXPRESSION;
-    table->data[1242].data[2].term = T_DO;
-    table->data[1242].data[3].is_nterm = true;
-    table->data[1242].data[3].nterm = NT_STATEMENT_LIST;
-    table->data[1242].data[4].term = T_END;
-    table->data[0] = (exp_list_t){ .valid = true, .size = 10, .data = alloc_tokens(10) };
-    table->data[0].data[0].term = T_FOR;
-    table->data[0].data[1].term = T_IDENTIFIER;
-    table->data[0].data[2].term = T_EQUALS;
-    table->data[0].data[3].is_nterm = true;
-    table->data[0].data[3].nterm = NT_EXPRESSION;
-    table->data[0].data[4].term = T_COMMA;
-    table->data[0].data[5].is_nterm = true;
-    table->data[0].data[5].nterm = NT_EXPRESSION;
-    table->data[0].data[6].is_nterm = true;
-    table->data[0].data[6].nterm = NT_OPTIONAL_FOR_STEP;
-    table->data[0].data[7].term = T_DO;
-    table->data[0].data[8].is_nterm = true;
-    table->data[0].data[8].nterm = NT_STATEMENT_LIST;
-    table->data[0].data[9].term = T_END;
-    table->data[1044] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1044].data[0].term = T_COMMA;
-    table->data[1044].data[1].is_nterm = true;
-    table->data[1044].data[1].nterm = NT_EXPRESSION;
-    table->data[1046] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1068] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[506] = (exp_list_t){ .valid = true, .size = 4, .data = alloc_tokens(4) };
-    table->data[506].data[0].term = T_REPEAT;
-    table->data[506].data[1].is_nterm = true;
-    table->data[506].data[1].nterm = NT_STATEMENT_LIST;
-    table->data[506].data[2].term = T_UNTIL;
-    table->data[506].data[3].is_nterm = true;
-    table->data[506].data[3].nterm = NT_EXPRESSION;
-    table->data[1251] = (exp_list_t){ .valid = true, .size = 5, .data = alloc_tokens(5) };
-    table->data[1251].data[0].term = T_LOCAL;
-    table->data[1251].data[1].term = T_IDENTIFIER;
-    table->data[1251].data[2].term = T_COLON;
-    table->data[1251].data[3].term = T_TYPE;
-    table->data[1251].data[4].is_nterm = true;
-    table->data[1251].data[4].nterm = NT_DECL_OPTIONAL_ASSIGNMENT;
-    table->data[315] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[315].data[0].term = T_EQUALS;
-    table->data[315].data[1].is_nterm = true;
-    table->data[315].data[1].nterm = NT_EXPRESSION;
-    table->data[293] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[314] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[307] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[316] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[277] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[321] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[286] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[291] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[289] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[275] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[288] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[301] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[319] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1166] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[1166].data[0].term = T_IDENTIFIER;
-    table->data[1166].data[1].term = T_COLON;
-    table->data[1166].data[2].term = T_TYPE;
-    table->data[801] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[801].data[0].is_nterm = true;
-    table->data[801].data[0].nterm = NT_IDENTIFIER_LIST;
-    table->data[801].data[1].term = T_EQUALS;
-    table->data[801].data[2].is_nterm = true;
-    table->data[801].data[2].nterm = NT_EXPRESSION_LIST;
-    table->data[52] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[52].data[0].term = T_IDENTIFIER;
-    table->data[52].data[1].is_nterm = true;
-    table->data[52].data[1].nterm = NT_IDENTIFIER_LIST2;
-    table->data[916] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[916].data[0].term = T_COMMA;
-    table->data[916].data[1].term = T_IDENTIFIER;
-    table->data[916].data[2].is_nterm = true;
-    table->data[916].data[2].nterm = NT_IDENTIFIER_LIST2;
-    table->data[936] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[940] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[628] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[628].data[0].is_nterm = true;
-    table->data[628].data[0].nterm = NT_EXPRESSION;
-    table->data[628].data[1].is_nterm = true;
-    table->data[628].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[614] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[614].data[0].is_nterm = true;
-    table->data[614].data[0].nterm = NT_EXPRESSION;
-    table->data[614].data[1].is_nterm = true;
-    table->data[614].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[629] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[629].data[0].is_nterm = true;
-    table->data[629].data[0].nterm = NT_EXPRESSION;
-    table->data[629].data[1].is_nterm = true;
-    table->data[629].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[603] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[603].data[0].is_nterm = true;
-    table->data[603].data[0].nterm = NT_EXPRESSION;
-    table->data[603].data[1].is_nterm = true;
-    table->data[603].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[631] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[631].data[0].is_nterm = true;
-    table->data[631].data[0].nterm = NT_EXPRESSION;
-    table->data[631].data[1].is_nterm = true;
-    table->data[631].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[600] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[600].data[0].is_nterm = true;
-    table->data[600].data[0].nterm = NT_EXPRESSION;
-    table->data[600].data[1].is_nterm = true;
-    table->data[600].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[609] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[609].data[0].is_nterm = true;
-    table->data[609].data[0].nterm = NT_EXPRESSION;
-    table->data[609].data[1].is_nterm = true;
-    table->data[609].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[633] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[633].data[0].is_nterm = true;
-    table->data[633].data[0].nterm = NT_EXPRESSION;
-    table->data[633].data[1].is_nterm = true;
-    table->data[633].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[637] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[637].data[0].is_nterm = true;
-    table->data[637].data[0].nterm = NT_EXPRESSION;
-    table->data[637].data[1].is_nterm = true;
-    table->data[637].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[598] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[598].data[0].is_nterm = true;
-    table->data[598].data[0].nterm = NT_EXPRESSION;
-    table->data[598].data[1].is_nterm = true;
-    table->data[598].data[1].nterm = NT_EXPRESSION_LIST2;
-    table->data[871] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[871].data[0].term = T_COMMA;
-    table->data[871].data[1].is_nterm = true;
-    table->data[871].data[1].nterm = NT_EXPRESSION;
-    table->data[871].data[2].is_nterm = true;
-    table->data[871].data[2].nterm = NT_EXPRESSION_LIST2;
-    table->data[869] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[890] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[883] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[892] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[853] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[897] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[862] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[867] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[865] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[851] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[864] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[877] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[895] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[544] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[544].data[0].is_nterm = true;
-    table->data[544].data[0].nterm = NT_RETURN_STATEMENT;
-    table->data[530] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[553] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[514] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[523] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[556] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[115] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[115].data[0].term = T_RETURN;
-    table->data[115].data[1].is_nterm = true;
-    table->data[115].data[1].nterm = NT_RET_EXPRESSION_LIST;
-    table->data[436] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[436].data[0].is_nterm = true;
-    table->data[436].data[0].nterm = NT_EXPRESSION;
-    table->data[436].data[1].is_nterm = true;
-    table->data[436].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[422] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[422].data[0].is_nterm = true;
-    table->data[422].data[0].nterm = NT_EXPRESSION;
-    table->data[422].data[1].is_nterm = true;
-    table->data[422].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[437] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[437].data[0].is_nterm = true;
-    table->data[437].data[0].nterm = NT_EXPRESSION;
-    table->data[437].data[1].is_nterm = true;
-    table->data[437].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[411] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[411].data[0].is_nterm = true;
-    table->data[411].data[0].nterm = NT_EXPRESSION;
-    table->data[411].data[1].is_nterm = true;
-    table->data[411].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[439] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[439].data[0].is_nterm = true;
-    table->data[439].data[0].nterm = NT_EXPRESSION;
-    table->data[439].data[1].is_nterm = true;
-    table->data[439].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[408] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[408].data[0].is_nterm = true;
-    table->data[408].data[0].nterm = NT_EXPRESSION;
-    table->data[408].data[1].is_nterm = true;
-    table->data[408].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[417] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[417].data[0].is_nterm = true;
-    table->data[417].data[0].nterm = NT_EXPRESSION;
-    table->data[417].data[1].is_nterm = true;
-    table->data[417].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[441] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[441].data[0].is_nterm = true;
-    table->data[441].data[0].nterm = NT_EXPRESSION;
-    table->data[441].data[1].is_nterm = true;
-    table->data[441].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[445] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[445].data[0].is_nterm = true;
-    table->data[445].data[0].nterm = NT_EXPRESSION;
-    table->data[445].data[1].is_nterm = true;
-    table->data[445].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[406] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[406].data[0].is_nterm = true;
-    table->data[406].data[0].nterm = NT_EXPRESSION;
-    table->data[406].data[1].is_nterm = true;
-    table->data[406].data[1].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[414] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[421] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[444] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[405] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[447] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[935] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[935].data[0].term = T_COMMA;
-    table->data[935].data[1].is_nterm = true;
-    table->data[935].data[1].nterm = NT_EXPRESSION;
-    table->data[935].data[2].is_nterm = true;
-    table->data[935].data[2].nterm = NT_RET_EXPRESSION_LIST2;
-    table->data[926] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[933] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[956] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[917] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[959] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[78] = (exp_list_t){ .valid = true, .size = 4, .data = alloc_tokens(4) };
-    table->data[78].data[0].term = T_IDENTIFIER;
-    table->data[78].data[1].term = T_LPAREN;
-    table->data[78].data[2].is_nterm = true;
-    table->data[78].data[2].nterm = NT_OPTIONAL_FUN_EXPRESSION_LIST;
-    table->data[78].data[3].term = T_RPAREN;
-    table->data[372] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[372].data[0].is_nterm = true;
-    table->data[372].data[0].nterm = NT_EXPRESSION;
-    table->data[372].data[1].is_nterm = true;
-    table->data[372].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[358] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[358].data[0].is_nterm = true;
-    table->data[358].data[0].nterm = NT_EXPRESSION;
-    table->data[358].data[1].is_nterm = true;
-    table->data[358].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[373] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[373].data[0].is_nterm = true;
-    table->data[373].data[0].nterm = NT_EXPRESSION;
-    table->data[373].data[1].is_nterm = true;
-    table->data[373].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[347] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[347].data[0].is_nterm = true;
-    table->data[347].data[0].nterm = NT_EXPRESSION;
-    table->data[347].data[1].is_nterm = true;
-    table->data[347].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[375] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[375].data[0].is_nterm = true;
-    table->data[375].data[0].nterm = NT_EXPRESSION;
-    table->data[375].data[1].is_nterm = true;
-    table->data[375].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[344] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[344].data[0].is_nterm = true;
-    table->data[344].data[0].nterm = NT_EXPRESSION;
-    table->data[344].data[1].is_nterm = true;
-    table->data[344].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[353] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[353].data[0].is_nterm = true;
-    table->data[353].data[0].nterm = NT_EXPRESSION;
-    table->data[353].data[1].is_nterm = true;
-    table->data[353].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[377] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[377].data[0].is_nterm = true;
-    table->data[377].data[0].nterm = NT_EXPRESSION;
-    table->data[377].data[1].is_nterm = true;
-    table->data[377].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[381] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[381].data[0].is_nterm = true;
-    table->data[381].data[0].nterm = NT_EXPRESSION;
-    table->data[381].data[1].is_nterm = true;
-    table->data[381].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[342] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[342].data[0].is_nterm = true;
-    table->data[342].data[0].nterm = NT_EXPRESSION;
-    table->data[342].data[1].is_nterm = true;
-    table->data[342].data[1].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[354] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[383] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[852] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[852].data[0].term = T_COMMA;
-    table->data[852].data[1].is_nterm = true;
-    table->data[852].data[1].nterm = NT_EXPRESSION;
-    table->data[852].data[2].is_nterm = true;
-    table->data[852].data[2].nterm = NT_FUN_EXPRESSION_LIST2;
-    table->data[847] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[876] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[180] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[180].data[0].is_nterm = true;
-    table->data[180].data[0].nterm = NT_TERM;
-    table->data[180].data[1].is_nterm = true;
-    table->data[180].data[1].nterm = NT_OPT_BINOP;
-    table->data[161] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[161].data[0].is_nterm = true;
-    table->data[161].data[0].nterm = NT_TERM;
-    table->data[161].data[1].is_nterm = true;
-    table->data[161].data[1].nterm = NT_OPT_BINOP;
-    table->data[166] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[166].data[0].is_nterm = true;
-    table->data[166].data[0].nterm = NT_TERM;
-    table->data[166].data[1].is_nterm = true;
-    table->data[166].data[1].nterm = NT_OPT_BINOP;
-    table->data[185] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[185].data[0].is_nterm = true;
-    table->data[185].data[0].nterm = NT_TERM;
-    table->data[185].data[1].is_nterm = true;
-    table->data[185].data[1].nterm = NT_OPT_BINOP;
-    table->data[155] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[155].data[0].is_nterm = true;
-    table->data[155].data[0].nterm = NT_TERM;
-    table->data[155].data[1].is_nterm = true;
-    table->data[155].data[1].nterm = NT_OPT_BINOP;
-    table->data[181] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[181].data[0].is_nterm = true;
-    table->data[181].data[0].nterm = NT_TERM;
-    table->data[181].data[1].is_nterm = true;
-    table->data[181].data[1].nterm = NT_OPT_BINOP;
-    table->data[150] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[150].data[0].is_nterm = true;
-    table->data[150].data[0].nterm = NT_TERM;
-    table->data[150].data[1].is_nterm = true;
-    table->data[150].data[1].nterm = NT_OPT_BINOP;
-    table->data[183] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[183].data[0].is_nterm = true;
-    table->data[183].data[0].nterm = NT_UNOP;
-    table->data[183].data[1].is_nterm = true;
-    table->data[183].data[1].nterm = NT_TERM;
-    table->data[183].data[2].is_nterm = true;
-    table->data[183].data[2].nterm = NT_OPT_BINOP;
-    table->data[152] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[152].data[0].is_nterm = true;
-    table->data[152].data[0].nterm = NT_UNOP;
-    table->data[152].data[1].is_nterm = true;
-    table->data[152].data[1].nterm = NT_TERM;
-    table->data[152].data[2].is_nterm = true;
-    table->data[152].data[2].nterm = NT_OPT_BINOP;
-    table->data[189] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[189].data[0].is_nterm = true;
-    table->data[189].data[0].nterm = NT_UNOP;
-    table->data[189].data[1].is_nterm = true;
-    table->data[189].data[1].nterm = NT_TERM;
-    table->data[189].data[2].is_nterm = true;
-    table->data[189].data[2].nterm = NT_OPT_BINOP;
-    table->data[1175] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1175].data[0].is_nterm = true;
-    table->data[1175].data[0].nterm = NT_BINOP;
-    table->data[1175].data[1].is_nterm = true;
-    table->data[1175].data[1].nterm = NT_EXPRESSION;
-    table->data[1214] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1214].data[0].is_nterm = true;
-    table->data[1214].data[0].nterm = NT_BINOP;
-    table->data[1214].data[1].is_nterm = true;
-    table->data[1214].data[1].nterm = NT_EXPRESSION;
-    table->data[1194] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1194].data[0].is_nterm = true;
-    table->data[1194].data[0].nterm = NT_BINOP;
-    table->data[1194].data[1].is_nterm = true;
-    table->data[1194].data[1].nterm = NT_EXPRESSION;
-    table->data[1201] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1201].data[0].is_nterm = true;
-    table->data[1201].data[0].nterm = NT_BINOP;
-    table->data[1201].data[1].is_nterm = true;
-    table->data[1201].data[1].nterm = NT_EXPRESSION;
-    table->data[1183] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1183].data[0].is_nterm = true;
-    table->data[1183].data[0].nterm = NT_BINOP;
-    table->data[1183].data[1].is_nterm = true;
-    table->data[1183].data[1].nterm = NT_EXPRESSION;
-    table->data[1216] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1216].data[0].is_nterm = true;
-    table->data[1216].data[0].nterm = NT_BINOP;
-    table->data[1216].data[1].is_nterm = true;
-    table->data[1216].data[1].nterm = NT_EXPRESSION;
-    table->data[1188] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1188].data[0].is_nterm = true;
-    table->data[1188].data[0].nterm = NT_BINOP;
-    table->data[1188].data[1].is_nterm = true;
-    table->data[1188].data[1].nterm = NT_EXPRESSION;
-    table->data[1199] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1199].data[0].is_nterm = true;
-    table->data[1199].data[0].nterm = NT_BINOP;
-    table->data[1199].data[1].is_nterm = true;
-    table->data[1199].data[1].nterm = NT_EXPRESSION;
-    table->data[1181] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1181].data[0].is_nterm = true;
-    table->data[1181].data[0].nterm = NT_BINOP;
-    table->data[1181].data[1].is_nterm = true;
-    table->data[1181].data[1].nterm = NT_EXPRESSION;
-    table->data[1180] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1180].data[0].is_nterm = true;
-    table->data[1180].data[0].nterm = NT_BINOP;
-    table->data[1180].data[1].is_nterm = true;
-    table->data[1180].data[1].nterm = NT_EXPRESSION;
-    table->data[1176] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1176].data[0].is_nterm = true;
-    table->data[1176].data[0].nterm = NT_BINOP;
-    table->data[1176].data[1].is_nterm = true;
-    table->data[1176].data[1].nterm = NT_EXPRESSION;
-    table->data[1177] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1177].data[0].is_nterm = true;
-    table->data[1177].data[0].nterm = NT_BINOP;
-    table->data[1177].data[1].is_nterm = true;
-    table->data[1177].data[1].nterm = NT_EXPRESSION;
-    table->data[1202] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1202].data[0].is_nterm = true;
-    table->data[1202].data[0].nterm = NT_BINOP;
-    table->data[1202].data[1].is_nterm = true;
-    table->data[1202].data[1].nterm = NT_EXPRESSION;
-    table->data[1206] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1206].data[0].is_nterm = true;
-    table->data[1206].data[0].nterm = NT_BINOP;
-    table->data[1206].data[1].is_nterm = true;
-    table->data[1206].data[1].nterm = NT_EXPRESSION;
-    table->data[1195] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1195].data[0].is_nterm = true;
-    table->data[1195].data[0].nterm = NT_BINOP;
-    table->data[1195].data[1].is_nterm = true;
-    table->data[1195].data[1].nterm = NT_EXPRESSION;
-    table->data[1178] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1178].data[0].is_nterm = true;
-    table->data[1178].data[0].nterm = NT_BINOP;
-    table->data[1178].data[1].is_nterm = true;
-    table->data[1178].data[1].nterm = NT_EXPRESSION;
-    table->data[1172] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[1172].data[0].is_nterm = true;
-    table->data[1172].data[0].nterm = NT_BINOP;
-    table->data[1172].data[1].is_nterm = true;
-    table->data[1172].data[1].nterm = NT_EXPRESSION;
-    table->data[1203] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1186] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1217] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1187] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1184] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1189] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1210] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1212] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1173] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1208] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1182] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1185] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1171] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1191] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1197] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1193] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[1215] = (exp_list_t){ .valid = true, .size = 0 };
-    table->data[562] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[562].data[0].term = T_PLUS;
-    table->data[536] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[536].data[0].term = T_MINUS;
-    table->data[561] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[561].data[0].term = T_ASTERISK;
-    table->data[554] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[554].data[0].term = T_SLASH;
-    table->data[555] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[555].data[0].term = T_PERCENT;
-    table->data[576] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[576].data[0].term = T_CARET;
-    table->data[541] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[541].data[0].term = T_DOUBLE_SLASH;
-    table->data[574] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[574].data[0].term = T_DOUBLE_DOT;
-    table->data[538] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[538].data[0].term = T_COLON;
-    table->data[559] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[559].data[0].term = T_LT;
-    table->data[566] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[566].data[0].term = T_GT;
-    table->data[532] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[532].data[0].term = T_LTE;
-    table->data[535] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[535].data[0].term = T_GTE;
-    table->data[543] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[543].data[0].term = T_DOUBLE_EQUALS;
-    table->data[537] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[537].data[0].term = T_TILDE_EQUALS;
-    table->data[548] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[548].data[0].term = T_AND;
-    table->data[540] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[540].data[0].term = T_OR;
-    table->data[133] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[133].data[0].term = T_MINUS;
-    table->data[170] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[170].data[0].term = T_HASH;
-    table->data[164] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[164].data[0].term = T_NOT;
-    table->data[963] = (exp_list_t){ .valid = true, .size = 3, .data = alloc_tokens(3) };
-    table->data[963].data[0].term = T_LPAREN;
-    table->data[963].data[1].is_nterm = true;
-    table->data[963].data[1].nterm = NT_EXPRESSION;
-    table->data[963].data[2].term = T_RPAREN;
-    table->data[974] = (exp_list_t){ .valid = true, .size = 2, .data = alloc_tokens(2) };
-    table->data[974].data[0].term = T_IDENTIFIER;
-    table->data[974].data[1].is_nterm = true;
-    table->data[974].data[1].nterm = NT_OPTIONAL_FUN_PARENS;
-    table->data[979] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[979].data[0].term = T_NUMBER;
-    table->data[998] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[998].data[0].term = T_INTEGER;
-    table->data[968] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[968].data[0].term = T_STRING;
-    table->data[994] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[994].data[0].term = T_BOOL;
-    table->data[993] = (exp_list_t){ .valid = true, .size = 1, .data = alloc_tokens(1) };
-    table->data[993].data[0].term = T_NIL;
-    return E_OK;
-}
-void parser_free()
-{
-    free(table);
-    free(mempool.data);
-}
+const exp_list_t parser_table[NTERM_COUNT][TERM_COUNT] = {
+    [NT_FOR_LOOP] = {
+        [T_FOR] = { .offset = 0, .size = 10, .valid = true },
+    },
+    [NT_FUNC_CALL] = {
+        [T_IDENTIFIER] = { .offset = 10, .size = 4, .valid = true },
+    },
+    [NT_UNOP] = {
+        [T_MINUS] = { .offset = 14, .size = 1, .valid = true },
+        [T_NOT] = { .offset = 15, .size = 1, .valid = true },
+        [T_HASH] = { .offset = 16, .size = 1, .valid = true },
+    },
+    [NT_FUNC_TYPE_LIST] = {
+        [T_FOR] = { .valid = true },
+        [T_COLON] = { .offset = 17, .size = 3, .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_FUNCTION] = { .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_GLOBAL] = { .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_IDENTIFIER_LIST_WITH_TYPES] = {
+        [T_IDENTIFIER] = { .offset = 20, .size = 2, .valid = true },
+        [T_RPAREN] = { .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_GLOBAL_STATEMENT] = {
+        [T_IDENTIFIER] = { .offset = 22, .size = 1, .valid = true },
+        [T_FUNCTION] = { .offset = 23, .size = 1, .valid = true },
+        [T_GLOBAL] = { .offset = 24, .size = 1, .valid = true },
+    },
+    [NT_TYPE_LIST2] = {
+        [T_RPAREN] = { .valid = true },
+        [T_COMMA] = { .offset = 25, .size = 3, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_COND_OPT_ELSEIF] = {
+        [T_ELSE] = { .offset = 28, .size = 3, .valid = true },
+        [T_ELSEIF] = { .offset = 31, .size = 5, .valid = true },
+        [T_END] = { .offset = 36, .size = 1, .valid = true },
+    },
+    [NT_OPT_RETURN_STATEMENT] = {
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_RETURN] = { .offset = 37, .size = 1, .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_IDENTIFIER_LIST_WITH_TYPES2] = {
+        [T_RPAREN] = { .valid = true },
+        [T_COMMA] = { .offset = 38, .size = 3, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_STATEMENT] = {
+        [T_FOR] = { .offset = 41, .size = 1, .valid = true },
+        [T_BREAK] = { .offset = 42, .size = 1, .valid = true },
+        [T_IDENTIFIER] = { .offset = 43, .size = 2, .valid = true },
+        [T_LOCAL] = { .offset = 45, .size = 1, .valid = true },
+        [T_WHILE] = { .offset = 46, .size = 1, .valid = true },
+        [T_REPEAT] = { .offset = 47, .size = 1, .valid = true },
+        [T_IF] = { .offset = 48, .size = 1, .valid = true },
+    },
+    [NT_FUNC_DECL] = {
+        [T_GLOBAL] = { .offset = 49, .size = 8, .valid = true },
+    },
+    [NT_FUNC_DEF] = {
+        [T_FUNCTION] = { .offset = 57, .size = 8, .valid = true },
+    },
+    [NT_FUN_EXPRESSION_LIST2] = {
+        [T_RPAREN] = { .valid = true },
+        [T_COMMA] = { .offset = 65, .size = 3, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_IDENTIFIER_LIST2] = {
+        [T_COMMA] = { .offset = 68, .size = 3, .valid = true },
+        [T_EQUALS] = { .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_TERM] = {
+        [T_LPAREN] = { .offset = 71, .size = 3, .valid = true },
+        [T_STRING] = { .offset = 74, .size = 1, .valid = true },
+        [T_IDENTIFIER] = { .offset = 75, .size = 2, .valid = true },
+        [T_NUMBER] = { .offset = 77, .size = 1, .valid = true },
+        [T_NIL] = { .offset = 78, .size = 1, .valid = true },
+        [T_BOOL] = { .offset = 79, .size = 1, .valid = true },
+        [T_INTEGER] = { .offset = 80, .size = 1, .valid = true },
+    },
+    [NT_OPTIONAL_FOR_STEP] = {
+        [T_COMMA] = { .offset = 81, .size = 2, .valid = true },
+        [T_DO] = { .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_PAREN_EXP_LIST_OR_ID_LIST2] = {
+        [T_LPAREN] = { .offset = 83, .size = 3, .valid = true },
+        [T_COMMA] = { .offset = 86, .size = 3, .valid = true },
+        [T_EQUALS] = { .offset = 86, .size = 3, .valid = true },
+    },
+    [NT_IDENTIFIER_WITH_TYPE] = {
+        [T_IDENTIFIER] = { .offset = 89, .size = 3, .valid = true },
+    },
+    [NT_WHILE_LOOP] = {
+        [T_WHILE] = { .offset = 92, .size = 5, .valid = true },
+    },
+    [NT_OPTIONAL_FUN_PARENS] = {
+        [T_FOR] = { .valid = true },
+        [T_LTE] = { .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_LPAREN] = { .offset = 83, .size = 3, .valid = true },
+        [T_GTE] = { .valid = true },
+        [T_MINUS] = { .valid = true },
+        [T_TILDE_EQUALS] = { .valid = true },
+        [T_COLON] = { .valid = true },
+        [T_OR] = { .valid = true },
+        [T_DOUBLE_SLASH] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_DOUBLE_EQUALS] = { .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_RPAREN] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_AND] = { .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_COMMA] = { .valid = true },
+        [T_DO] = { .valid = true },
+        [T_SLASH] = { .valid = true },
+        [T_PERCENT] = { .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_LT] = { .valid = true },
+        [T_ASTERISK] = { .valid = true },
+        [T_PLUS] = { .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_GT] = { .valid = true },
+        [T_THEN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_END] = { .valid = true },
+        [T_DOUBLE_DOT] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_CARET] = { .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_RETURN_STATEMENT] = {
+        [T_RETURN] = { .offset = 97, .size = 2, .valid = true },
+    },
+    [NT_EXPRESSION] = {
+        [T_LPAREN] = { .offset = 99, .size = 2, .valid = true },
+        [T_MINUS] = { .offset = 101, .size = 3, .valid = true },
+        [T_STRING] = { .offset = 99, .size = 2, .valid = true },
+        [T_IDENTIFIER] = { .offset = 99, .size = 2, .valid = true },
+        [T_NUMBER] = { .offset = 99, .size = 2, .valid = true },
+        [T_NIL] = { .offset = 99, .size = 2, .valid = true },
+        [T_BOOL] = { .offset = 99, .size = 2, .valid = true },
+        [T_NOT] = { .offset = 101, .size = 3, .valid = true },
+        [T_INTEGER] = { .offset = 99, .size = 2, .valid = true },
+        [T_HASH] = { .offset = 101, .size = 3, .valid = true },
+    },
+    [NT_TYPE_LIST] = {
+        [T_RPAREN] = { .valid = true },
+        [T_TYPE] = { .offset = 104, .size = 2, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_DECL_OPTIONAL_ASSIGNMENT] = {
+        [T_FOR] = { .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_EQUALS] = { .offset = 106, .size = 2, .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_OPTIONAL_FUN_EXPRESSION_LIST] = {
+        [T_LPAREN] = { .offset = 108, .size = 2, .valid = true },
+        [T_MINUS] = { .offset = 108, .size = 2, .valid = true },
+        [T_STRING] = { .offset = 108, .size = 2, .valid = true },
+        [T_IDENTIFIER] = { .offset = 108, .size = 2, .valid = true },
+        [T_RPAREN] = { .valid = true },
+        [T_NUMBER] = { .offset = 108, .size = 2, .valid = true },
+        [T_NIL] = { .offset = 108, .size = 2, .valid = true },
+        [T_BOOL] = { .offset = 108, .size = 2, .valid = true },
+        [T_NOT] = { .offset = 108, .size = 2, .valid = true },
+        [T_INTEGER] = { .offset = 108, .size = 2, .valid = true },
+        [T_HASH] = { .offset = 108, .size = 2, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_RET_EXPRESSION_LIST] = {
+        [T_ELSE] = { .valid = true },
+        [T_LPAREN] = { .offset = 110, .size = 2, .valid = true },
+        [T_MINUS] = { .offset = 110, .size = 2, .valid = true },
+        [T_STRING] = { .offset = 110, .size = 2, .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_IDENTIFIER] = { .offset = 110, .size = 2, .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_NUMBER] = { .offset = 110, .size = 2, .valid = true },
+        [T_NIL] = { .offset = 110, .size = 2, .valid = true },
+        [T_BOOL] = { .offset = 110, .size = 2, .valid = true },
+        [T_NOT] = { .offset = 110, .size = 2, .valid = true },
+        [T_INTEGER] = { .offset = 110, .size = 2, .valid = true },
+        [T_END] = { .valid = true },
+        [T_HASH] = { .offset = 110, .size = 2, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_REPEAT_UNTIL] = {
+        [T_REPEAT] = { .offset = 112, .size = 4, .valid = true },
+    },
+    [NT_BINOP] = {
+        [T_LTE] = { .offset = 116, .size = 1, .valid = true },
+        [T_GTE] = { .offset = 117, .size = 1, .valid = true },
+        [T_MINUS] = { .offset = 14, .size = 1, .valid = true },
+        [T_TILDE_EQUALS] = { .offset = 118, .size = 1, .valid = true },
+        [T_COLON] = { .offset = 119, .size = 1, .valid = true },
+        [T_OR] = { .offset = 120, .size = 1, .valid = true },
+        [T_DOUBLE_SLASH] = { .offset = 121, .size = 1, .valid = true },
+        [T_DOUBLE_EQUALS] = { .offset = 122, .size = 1, .valid = true },
+        [T_AND] = { .offset = 123, .size = 1, .valid = true },
+        [T_SLASH] = { .offset = 124, .size = 1, .valid = true },
+        [T_PERCENT] = { .offset = 125, .size = 1, .valid = true },
+        [T_LT] = { .offset = 126, .size = 1, .valid = true },
+        [T_ASTERISK] = { .offset = 127, .size = 1, .valid = true },
+        [T_PLUS] = { .offset = 128, .size = 1, .valid = true },
+        [T_GT] = { .offset = 129, .size = 1, .valid = true },
+        [T_DOUBLE_DOT] = { .offset = 130, .size = 1, .valid = true },
+        [T_CARET] = { .offset = 131, .size = 1, .valid = true },
+    },
+    [NT_EXPRESSION_LIST] = {
+        [T_LPAREN] = { .offset = 132, .size = 2, .valid = true },
+        [T_MINUS] = { .offset = 132, .size = 2, .valid = true },
+        [T_STRING] = { .offset = 132, .size = 2, .valid = true },
+        [T_IDENTIFIER] = { .offset = 132, .size = 2, .valid = true },
+        [T_NUMBER] = { .offset = 132, .size = 2, .valid = true },
+        [T_NIL] = { .offset = 132, .size = 2, .valid = true },
+        [T_BOOL] = { .offset = 132, .size = 2, .valid = true },
+        [T_NOT] = { .offset = 132, .size = 2, .valid = true },
+        [T_INTEGER] = { .offset = 132, .size = 2, .valid = true },
+        [T_HASH] = { .offset = 132, .size = 2, .valid = true },
+    },
+    [NT_STATEMENT_LIST] = {
+        [T_FOR] = { .offset = 134, .size = 3, .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_BREAK] = { .offset = 134, .size = 3, .valid = true },
+        [T_IDENTIFIER] = { .offset = 134, .size = 3, .valid = true },
+        [T_LOCAL] = { .offset = 134, .size = 3, .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_WHILE] = { .offset = 134, .size = 3, .valid = true },
+        [T_RETURN] = { .offset = 137, .size = 1, .valid = true },
+        [T_REPEAT] = { .offset = 134, .size = 3, .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .offset = 137, .size = 1, .valid = true },
+        [T_IF] = { .offset = 134, .size = 3, .valid = true },
+    },
+    [NT_FUNC_TYPE_LIST2] = {
+        [T_FOR] = { .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_COMMA] = { .offset = 138, .size = 3, .valid = true },
+        [T_FUNCTION] = { .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_GLOBAL] = { .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_ASSIGNMENT] = {
+        [T_IDENTIFIER] = { .offset = 141, .size = 3, .valid = true },
+    },
+    [NT_EXPRESSION_LIST2] = {
+        [T_FOR] = { .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_COMMA] = { .offset = 144, .size = 3, .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_RET_EXPRESSION_LIST2] = {
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_COMMA] = { .offset = 147, .size = 3, .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+    [NT_PROGRAM] = {
+        [T_REQUIRE] = { .offset = 150, .size = 3, .valid = true },
+    },
+    [NT_COND_STATEMENT] = {
+        [T_IF] = { .offset = 153, .size = 5, .valid = true },
+    },
+    [NT_STATEMENT_LIST2] = {
+        [T_FOR] = { .offset = 158, .size = 2, .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_BREAK] = { .offset = 158, .size = 2, .valid = true },
+        [T_IDENTIFIER] = { .offset = 158, .size = 2, .valid = true },
+        [T_LOCAL] = { .offset = 158, .size = 2, .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_WHILE] = { .offset = 158, .size = 2, .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_REPEAT] = { .offset = 158, .size = 2, .valid = true },
+        [T_END] = { .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_IF] = { .offset = 158, .size = 2, .valid = true },
+    },
+    [NT_OPT_BINOP] = {
+        [T_FOR] = { .valid = true },
+        [T_LTE] = { .offset = 160, .size = 2, .valid = true },
+        [T_ELSE] = { .valid = true },
+        [T_GTE] = { .offset = 160, .size = 2, .valid = true },
+        [T_MINUS] = { .offset = 160, .size = 2, .valid = true },
+        [T_TILDE_EQUALS] = { .offset = 160, .size = 2, .valid = true },
+        [T_COLON] = { .offset = 160, .size = 2, .valid = true },
+        [T_OR] = { .offset = 160, .size = 2, .valid = true },
+        [T_DOUBLE_SLASH] = { .offset = 160, .size = 2, .valid = true },
+        [T_ELSEIF] = { .valid = true },
+        [T_DOUBLE_EQUALS] = { .offset = 160, .size = 2, .valid = true },
+        [T_BREAK] = { .valid = true },
+        [T_IDENTIFIER] = { .valid = true },
+        [T_RPAREN] = { .valid = true },
+        [T_LOCAL] = { .valid = true },
+        [T_AND] = { .offset = 160, .size = 2, .valid = true },
+        [T_UNTIL] = { .valid = true },
+        [T_COMMA] = { .valid = true },
+        [T_DO] = { .valid = true },
+        [T_SLASH] = { .offset = 160, .size = 2, .valid = true },
+        [T_PERCENT] = { .offset = 160, .size = 2, .valid = true },
+        [T_WHILE] = { .valid = true },
+        [T_LT] = { .offset = 160, .size = 2, .valid = true },
+        [T_ASTERISK] = { .offset = 160, .size = 2, .valid = true },
+        [T_PLUS] = { .offset = 160, .size = 2, .valid = true },
+        [T_RETURN] = { .valid = true },
+        [T_GT] = { .offset = 160, .size = 2, .valid = true },
+        [T_THEN] = { .valid = true },
+        [T_REPEAT] = { .valid = true },
+        [T_END] = { .valid = true },
+        [T_DOUBLE_DOT] = { .offset = 160, .size = 2, .valid = true },
+        [T_EOF] = { .valid = true },
+        [T_CARET] = { .offset = 160, .size = 2, .valid = true },
+        [T_IF] = { .valid = true },
+    },
+    [NT_DECLARATION] = {
+        [T_LOCAL] = { .offset = 162, .size = 5, .valid = true },
+    },
+    [NT_IDENTIFIER_LIST] = {
+        [T_IDENTIFIER] = { .offset = 167, .size = 2, .valid = true },
+    },
+    [NT_GLOBAL_STATEMENT_LIST] = {
+        [T_IDENTIFIER] = { .offset = 169, .size = 2, .valid = true },
+        [T_FUNCTION] = { .offset = 169, .size = 2, .valid = true },
+        [T_GLOBAL] = { .offset = 169, .size = 2, .valid = true },
+        [T_EOF] = { .valid = true },
+    },
+};
@@ -18,9 +18,8 @@
 #include "error.h"
 #include "parser-precedence-table.h"
 #include "dynstring.h"
-#include "stack.h"
-#include "deque.h"
 #include "ast.h"
+#include "typed_stack.h"
 #include "scanner.h"
 #include "parser.h"
 #include "parser-generated.h"
@@ -49,6 +48,9 @@ static int dbgseverity = 7;
 
 #endif
 
+/// parser stack elements held in precedence_parse() frame before the stack moves to the heap
+#define PREC_STACK_INLINE_LENGTH 32
+
 typedef enum
 {
     RULE_UNOP,
@@ -75,8 +77,17 @@ typedef struct {
     token_t token;
     entry_type type;
     bool mark;
+    ast_node_t *node; ///< expression the nonterminal was reduced from
 } stack_element_t;
 
+/// parser stack of elements stored by value, the sentinel is at the bottom
+DEFINE_STACK(prec_stack, stack_element_t)
+
+static inline bool is_sentinel(prec_stack_t *stack, stack_element_t *element)
+{
+    return element == stack->array;
+}
+
 static bool check_rparen(stack_element_t *element)
 {
     return element->token.token_type == T_RPAREN;
@@ -140,12 +151,6 @@ typedef struct {
     rule_function list[3];
 } rule_t;
 
-typedef struct {
-    size_t size;
-    int id;
-    stack_element_t *array[];
-} element_array_t;
-
 static const rule_t rules[] = {
     [RULE_UNOP] = { check_unop, 2, { check_nonterm, check_unop } },
     [RULE_BINOP] = { check_binop, 3, { check_nonterm, check_binop, check_nonterm } }, // binop rule
@@ -156,7 +161,7 @@ static const rule_t rules[] = {
     [RULE_LITERAL] = { check_literal, 1, { check_literal } }
 };
 
-static void print_element(stack_element_t *e, stack_element_t *sen, int severity)
+static void print_element(stack_element_t *e, prec_stack_t *stack, int severity)
 {
 #ifdef DBG
     if(severity < dbgseverity) {
@@ -170,7 +175,7 @@ static void print_element(stack_element_t *e, stack_element_t *sen, int severity
         fprintf(stderr, "<");
     }
 
-    if(e == sen) {
+    if(is_sentinel(stack, e)) {
         fprintf(stderr, "DOLLAR SENTINEL\n");
     } else {
         switch(e->type) {
@@ -180,7 +185,7 @@ static void print_element(stack_element_t *e, stack_element_t *sen, int severity
         case FLAG_TERM:
             fprintf(stderr, "%s", term_to_string(e->token.token_type));
             if(e->token.token_type == T_IDENTIFIER) {
-                fprintf(stderr, " id: %s", e->token.string.ptr);
+                fprintf(stderr, " id: %.*s", (int) e->token.lexeme.length, e->token.lexeme.ptr);
             }
             fprintf(stderr, "\n");
             break;
@@ -188,22 +193,20 @@ static void print_element(stack_element_t *e, stack_element_t *sen, int severity
     }
 #else
     (void) e;
-    (void) sen;
+    (void) stack;
     (void) severity;
 #endif
 }
 
-static void dbg_print(deque_t *stack, int depth, int severity)
+static void dbg_print(prec_stack_t *stack, int depth, int severity)
 {
 #ifdef DBG
     if(severity < dbgseverity) {
         return;
     }
-    deque_element_t *e = deque_front_element(stack);
-
     DPRINT(severity, "Stack: { ");
-    while(e) {
-        stack_element_t *d = (stack_element_t *) e->data;
+    for(size_t i = stack->size; i > 0; i--) {
+        stack_element_t *d = &stack->array[i - 1];
         const char *s;
         switch(d->type) {
         case FLAG_TERM:
@@ -218,7 +221,6 @@ static void dbg_print(deque_t *stack, int depth, int severity)
             fprintf(stderr, "<");
         }
         fprintf(stderr, "%s", s);
-        e = e->next;
     }
     fprintf(stderr, " }\n");
 #else
@@ -228,28 +230,6 @@ static void dbg_print(deque_t *stack, int depth, int severity)
 #endif
 }
 
-stack_element_t *create_element(token_t *token, stack_element_t *sen)
-{
-    stack_element_t *temp = malloc(sizeof(stack_element_t));
-    if(temp) {
-        temp->token = *token;
-        temp->type = FLAG_TERM;
-        temp->mark = false;
-        print_element(temp, sen, 1);
-    }
-    return temp;
-}
-
-stack_element_t *create_element_empty(entry_type type)
-{
-    stack_element_t *temp = malloc(sizeof(stack_element_t));
-    if(temp) {
-        temp->type = type;
-        temp->mark = false;
-    }
-    return temp;
-}
-
 ast_node_binop_type_t term_to_binop_type(term_type_t type)
 {
     switch(type) {
@@ -314,81 +294,125 @@ bool is_table_terminal(term_type_t type)
     return false;
 }
 
-stack_element_t *parser_top(deque_t *stack)
+stack_element_t *parser_top(prec_stack_t *stack)
 {
-    deque_element_t *it = deque_front_element(stack);
-    stack_element_t *e = NULL;
-    while(it) {
-        e = (stack_element_t *) it->data;
-        if(e->type == FLAG_TERM) {
-            break;
+    for(size_t i = stack->size; i > 0; i--) {
+        if(stack->array[i - 1].type == FLAG_TERM) {
+            return &stack->array[i - 1];
         }
-        it = it->next;
     }
-    return e;
+    return NULL;
 }
 
-static void free_stack(adt_stack_t *stack)
+static int push_nonterm(prec_stack_t *stack, ast_node_t *node)
 {
-    while(!stack_empty(stack)) {
-        element_array_t *a = (element_array_t *) stack_pop(stack);
-        for(size_t i = 0; i < a->size; ++i) {
-            stack_element_t *e = a->array[i];
-            // print_element(e, sen);
-            free(e);
-        }
-        free(a);
-    }
-    stack_free(stack);
+    stack_element_t e = { .type = FLAG_NONTERM, .node = node };
+    return prec_stack_push(stack, e);
 }
 
-static void free_deque(deque_t *stack, stack_element_t *sen)
-{
-    while(!deque_empty(stack)) {
-        stack_element_t *e = (stack_element_t *) deque_pop_front(stack);
-        print_element(e, sen, 1);
-        free(e);
-    }
-    deque_free(stack);
-}
-
-static void free_parser_bottom_up(deque_t *stack, adt_stack_t *right_analysis, stack_element_t *sen)
-{
-    free_deque(stack, sen);
-    free_stack(right_analysis);
-}
-
-static int push_nonterm(deque_t *stack)
+/**
+ * @brief Builds AST node of a reduced handle.
+ *
+ * @param id rule the handle matched
+ * @param handle elements of the handle, from bottom of the stack
+ * @param[out] node built node
+ * @return E_INT on allocation error, otherwise E_OK
+ */
+static int build_node(int id, stack_element_t *handle, ast_node_t **node)
 {
-    stack_element_t *e = create_element_empty(FLAG_NONTERM);
-    if(!e) {
-        return E_INT;
+    switch(id) {
+    case RULE_UNOP:
+        if(!(*node = ast_alloc_node(AST_NODE_UNOP))) {
+            return E_INT;
+        }
+        (*node)->unop.type = term_to_unop_type(handle[0].token.token_type);
+        (*node)->unop.operand = handle[1].node;
+        break;
+    case RULE_BINOP:
+        if(!(*node = ast_alloc_node(AST_NODE_BINOP))) {
+            return E_INT;
+        }
+        (*node)->binop.type = term_to_binop_type(handle[1].token.token_type);
+        (*node)->binop.left = handle[0].node;
+        (*node)->binop.right = handle[2].node;
+        break;
+    case RULE_ID:
+        if(!(*node = ast_alloc_node(AST_NODE_SYMBOL))) {
+            return E_INT;
+        }
+        str_view_t id = handle[0].token.lexeme;
+        (*node)->symbol.name = atom_intern(id.ptr, id.length);
+        if((*node)->symbol.name == NULL) {
+            return E_INT;
+        }
+        (*node)->symbol.is_declaration = true;
+        break;
+    case RULE_PARENTHESES:
+        *node = handle[1].node;
+        break;
+    case RULE_LITERAL: {
+        token_t *t = &handle[0].token;
+        ast_node_type_t type;
+        switch(t->token_type) {
+        case T_INTEGER:
+            type = AST_NODE_INTEGER;
+            break;
+        case T_STRING:
+            type = AST_NODE_STRING;
+            break;
+        case T_NUMBER:
+            type = AST_NODE_NUMBER;
+            break;
+        case T_BOOL:
+            type = AST_NODE_BOOLEAN;
+            break;
+        case T_NIL:
+            type = AST_NODE_NIL;
+            break;
+        default:
+            return E_INT;
+        }
+        if(!(*node = ast_alloc_node(type))) {
+            return E_INT;
+        }
+        switch(type) {
+        case AST_NODE_INTEGER:
+            (*node)->integer = t->integer;
+            break;
+        case AST_NODE_STRING:
+            if(ast_alloc_string(t->lexeme.ptr, t->lexeme.length, &(*node)->string)) {
+                return E_INT;
+            }
+            break;
+        case AST_NODE_NUMBER:
+            (*node)->number = t->number;
+            break;
+        case AST_NODE_BOOLEAN:
+            (*node)->boolean = t->boolean;
+            break;
+        default:
+            break;
+        }
+    } break;
     }
-    return deque_push_front(stack, e);
+    return E_OK;
 }
 
-static int execute_rule(int id, deque_t *stack, const rule_t *rule, adt_stack_t *output,
-                        stack_element_t *sen, int depth)
+static int execute_rule(int id, prec_stack_t *stack, const rule_t *rule, int depth)
 {
     (void) depth;
 
-    element_array_t *group =
-        calloc(sizeof(element_array_t) + rule->list_size * sizeof(element_array_t *), sizeof(char));
-    if(!group) {
-        return E_INT;
-    }
-    group->size = rule->list_size;
-    group->id = id;
-
-    if(stack_push(output, group) != E_OK) {
-        return E_INT;
-    }
     DPRINT(1, "Exec rule: %d\n", id);
+    // the handle has to be preceded by a marked element, the sentinel at least
+    if(stack->size <= rule->list_size) {
+        DPRINT(8, "[INTERNAL, PREC_PARSER] Syntax error: sequence underflow.\n");
+        return E_SEM;
+    }
+    stack_element_t *handle = &stack->array[stack->size - rule->list_size];
     for(size_t i = 0; i < rule->list_size; ++i) {
         DPRINT(1, "Rule i: %lu\n", i);
-        dbg_print(stack, 0, 1);
-        stack_element_t *e = deque_front(stack);
-        if(!e || e->mark) {
+        stack_element_t *e = &handle[rule->list_size - 1 - i];
+        if(e->mark) {
             DPRINT(8, "[INTERNAL, PREC_PARSER] Syntax error: sequence underflow.\n");
             return E_SEM;
         }
@@ -397,21 +421,24 @@ static int execute_rule(int id, deque_t *stack, const rule_t *rule, adt_stack_t
             DPRINT(8, "[INTERNAL, PREC_PARSER] Syntax error: wrong nut. \n");
             return E_SEM;
         }
-
-        deque_pop_front(stack);
-
-        group->array[i] = e;
     }
 
-    stack_element_t *e = deque_front(stack);
-    print_element(e, sen, 1);
+    stack_element_t *e = handle - 1;
+    print_element(e, stack, 1);
     if(!e->mark) {
         DPRINT(8, "[INTERNAL, PREC_PARSER] Syntax error: sequence overflow.\n");
         return E_SEM;
     }
     e->mark = false;
 
-    if(push_nonterm(stack) != E_OK) {
+    ast_node_t *node = NULL;
+    if(build_node(id, handle, &node) != E_OK) {
+        return E_INT;
+    }
+
+    // the nonterminal replaces the handle, so pushing it can't grow the stack
+    stack->size -= rule->list_size;
+    if(push_nonterm(stack, node) != E_OK) {
         return E_INT;
     }
 
@@ -420,8 +447,7 @@ static int execute_rule(int id, deque_t *stack, const rule_t *rule, adt_stack_t
     return E_OK;
 }
 
-static int parser_reduce(deque_t *stack, stack_element_t *top, adt_stack_t *output, int depth,
-                         stack_element_t *sen)
+static int parser_reduce(prec_stack_t *stack, stack_element_t *top, int depth)
 {
     (void) depth;
 
@@ -431,7 +457,7 @@ static int parser_reduce(deque_t *stack, stack_element_t *top, adt_stack_t *outp
     for(size_t i = 0; i < sizeof(rules) / sizeof(rule_t); ++i) {
 
         if(rules[i].condition(top)) {
-            r = execute_rule(i, stack, &rules[i], output, sen, depth);
+            r = execute_rule(i, stack, &rules[i], depth);
             executed = true;
             break;
         }
@@ -462,43 +488,41 @@ static int prec_get_next_token(token_t *current, int *level)
     return E_OK;
 }
 
-static int parser_shift(deque_t *stack, token_t *current, int *level, int depth,
-                        stack_element_t *sen)
+static int parser_shift(prec_stack_t *stack, token_t *current, int *level, int depth)
 {
-    stack_element_t *element = create_element(current, sen);
-    // DPRINT("Pushing to P[%d]: ", depth);
-    /// print_element(element, sen);
-    if(!element || deque_push_front(stack, element) != E_OK) {
+    stack_element_t element = { .token = *current, .type = FLAG_TERM };
+    if(prec_stack_push(stack, element) != E_OK) {
         return E_INT;
     }
+    print_element(prec_stack_top(stack), stack, 1);
     dbg_print(stack, depth, 1);
     return prec_get_next_token(current, level);
 }
 
-static bool check_condition(deque_t *stack, int depth, stack_element_t *sentinel)
+static bool check_condition(prec_stack_t *stack, int depth)
 {
     (void) depth;
-    stack_element_t *current_top = deque_front(stack);
+    stack_element_t *current_top = prec_stack_top(stack);
     DPRINT(1, " >> CHECK: ");
-    print_element(current_top, sentinel, 1);
+    print_element(current_top, stack, 1);
     //    stack_element_t *top = parser_top(stack);
     bool cond = is_binary_op(current_top->token.token_type) ||
                 is_unary_op(current_top->token.token_type) ||
                 current_top->token.token_type == T_LPAREN;
     // current_top->type == FLAG_NONTERM
-    if(!cond && current_top != sentinel) {
+    if(!cond && !is_sentinel(stack, current_top)) {
         DPRINT(1, "Return contol condition\n");
         return true;
     }
     return false;
 }
 
-static int parse_func_call(deque_t *stack, adt_stack_t *output, token_t *current,
-                           int *parentheses_level, stack_element_t *sentinel, int depth)
+static int parse_func_call(prec_stack_t *stack, token_t *current, int *parentheses_level,
+                           int depth)
 {
     ast_node_t *node = NULL;
 
-    unget_token();
+    // function call starts with the current identifier
     unget_token();
     int err = parse(NT_FUNC_CALL, &node, 0);
     if(err != E_OK) {
@@ -514,27 +538,10 @@ static int parse_func_call(deque_t *stack, adt_stack_t *output, token_t *current
     DPRINT(3, "  Current: %s\n", term_to_readable(current->token_type));
     DPRINT(2, "  PLevel: %d\n", *parentheses_level);
 
-    element_array_t *group =
-        calloc(sizeof(element_array_t) + 1 * sizeof(element_array_t *), sizeof(char));
-    if(!group) {
-        // free node
-        return E_INT;
-    }
-    group->size = 1;
-    group->id = RULE_FUNC_CALL;
-
-    if(stack_push(output, group) != E_OK) {
-        // free node
-        return E_INT;
-    }
-
-    group->array[0] = (void *) node;
-
-    stack_element_t *e = deque_front(stack);
     DPRINT(1, "Stopped at: ");
-    print_element(e, sentinel, 1);
+    print_element(prec_stack_top(stack), stack, 1);
 
-    if(push_nonterm(stack) != E_OK) {
+    if(push_nonterm(stack, node) != E_OK) {
         return E_INT;
     }
 
@@ -545,8 +552,7 @@ static int parse_func_call(deque_t *stack, adt_stack_t *output, token_t *current
     return E_OK;
 }
 
-static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_element_t *sentinel,
-                      token_t *current)
+static int parse_loop(prec_stack_t *stack, int depth, token_t *current)
 {
     int parentheses_level = 0;
     int result = E_OK;
@@ -571,22 +577,21 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
         DPRINT(2, "Top: %s\n", term_to_readable(top->token.token_type));
         DPRINT(2, "Current: %s\n", term_to_readable(current->token_type));
         if(current->token_type == T_IDENTIFIER) {
-            DPRINT(2, "  current id: %s\n", current->string.ptr);
+            DPRINT(2, "  current id: %.*s\n", (int) current->lexeme.length, current->lexeme.ptr);
         }
         dbg_print(stack, depth, 1);
         if(current->token_type == T_IDENTIFIER && !return_control) {
 
-            return_control = check_condition(stack, depth, sentinel);
+            return_control = check_condition(stack, depth);
 
             if(!return_control) {
                 token_t lookahead;
-                get_next_token(&lookahead);
+                peek_token(0, &lookahead);
                 DPRINT(2, "Lookahead: %s\n", term_to_readable(lookahead.token_type));
                 if(lookahead.token_type == T_LPAREN) {
                     DPRINT(6, "<< Switch to TOP DOWN\n");
 
-                    int r = parse_func_call(stack, output, current, &parentheses_level, sentinel,
-                                            depth);
+                    int r = parse_func_call(stack, current, &parentheses_level, depth);
                     if(r != E_OK) {
                         return r;
                     }
@@ -596,14 +601,12 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
                     }
 
                     continue;
-                } else {
-                    unget_token();
                 }
             }
         }
 
         if(current->token_type == T_RPAREN) {
-            if(parentheses_level == -1 && top == sentinel) {
+            if(parentheses_level == -1 && is_sentinel(stack, top)) {
                 unget_token();
                 DPRINT(6, "<< Switch to TOP DOWN (end of func call)\n");
                 break;
@@ -612,20 +615,20 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
 
         if(current->token_type == T_MINUS) {
             DPRINT(1, ">>>> T_MINUS case: \n");
-            stack_element_t *current_top = deque_front(stack);
-            print_element(current_top, sentinel, 9);
+            stack_element_t *current_top = prec_stack_top(stack);
+            print_element(current_top, stack, 9);
             dbg_print(stack, depth, 1);
             if(current_top->type != FLAG_NONTERM &&
-               (current_top == sentinel || is_binary_op(current_top->token.token_type) ||
+               (is_sentinel(stack, current_top) || is_binary_op(current_top->token.token_type) ||
                 is_unary_op(current_top->token.token_type))) {
                 DPRINT(5, ">> SET TO UNARY\n");
                 current->token_type = T_MINUS_UNARY;
             }
         }
 
-        token_t token = is_table_terminal(current->token_type) ? *current : sentinel->token;
+        token_t token = is_table_terminal(current->token_type) ? *current : stack->array[0].token;
 
-        if(top == sentinel && (token.token_type == T_EOF || return_control)) {
+        if(is_sentinel(stack, top) && (token.token_type == T_EOF || return_control)) {
             DPRINT(4, "stopping: end condition\n");
             unget_token();
             break;
@@ -644,29 +647,29 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
         case PREC_EQ:
             DPRINT(3, "case prec_eq\n");
             if(!return_control) {
-                result = parser_shift(stack, current, &parentheses_level, depth, sentinel);
+                result = parser_shift(stack, current, &parentheses_level, depth);
             }
             break;
         case PREC_LT:
             DPRINT(3, "case prec_lt\n");
             if(!return_control) {
                 top->mark = true;
-                result = parser_shift(stack, current, &parentheses_level, depth, sentinel);
+                result = parser_shift(stack, current, &parentheses_level, depth);
             }
             break;
         case PREC_GT:
             DPRINT(3, "case prec_gt\n");
-            result = parser_reduce(stack, top, output, depth, sentinel);
+            result = parser_reduce(stack, top, depth);
             break;
         case PREC_ZE:
             DPRINT(3, "case prec_void\n");
             DPRINT(3, "Top: %s\n", term_to_readable(top->token.token_type));
             DPRINT(3, "Current: %s\n", term_to_readable(current->token_type));
             if(current->token_type == T_IDENTIFIER) {
-                parser_reduce(stack, top, output, depth, sentinel);
+                parser_reduce(stack, top, depth);
                 top = parser_top(stack);
                 return_control = true;
-                if(top == sentinel) {
+                if(is_sentinel(stack, top)) {
                     unget_token();
                     break;
                 }
@@ -688,7 +691,7 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
         //        }
     }
 
-    if(top != sentinel) {
+    if(!is_sentinel(stack, top)) {
         dbg_print(stack, depth, 8);
         DPRINT(8, "[INTERNAL, PREC_PARSER] stack not empty:\n");
         dbg_print(stack, depth, 8);
@@ -698,147 +701,40 @@ static int parse_loop(deque_t *stack, adt_stack_t *output, int depth, stack_elem
     return result;
 }
 
-static int assemble_ast(adt_stack_t *right_analysis, ast_node_t **node, stack_element_t *sen,
-                        int depth)
-{
-    if(stack_empty(right_analysis)) {
-        return E_INT;
-    }
-
-    element_array_t *a = (element_array_t *) stack_pop(right_analysis);
-    DPRINT(3, "  Rule %d: {\n", a->id);
-    if(a->id == RULE_FUNC_CALL) {
-        DPRINT(3, "    %d\n", ((ast_node_t *) a->array[0])->node_type);
-    } else {
-        for(size_t i = 0; i < a->size; ++i) {
-            stack_element_t *e = a->array[i];
-            DPRINT(3, "    ");
-            print_element(e, sen, 3);
-        }
-    }
-    DPRINT(3, "  }\n");
-
-    if(a->id != RULE_FUNC_CALL) {
-        *node = calloc(1, sizeof(ast_node_t));
-    }
-
-    switch(a->id) {
-    case RULE_UNOP:
-        (*node)->node_type = AST_NODE_UNOP;
-        (*node)->unop.type = term_to_unop_type(a->array[1]->token.token_type);
-        if(assemble_ast(right_analysis, &(*node)->unop.operand, sen, depth) != E_OK) {
-            return E_INT;
-        }
-        break;
-    case RULE_BINOP:
-        (*node)->node_type = AST_NODE_BINOP;
-        (*node)->binop.type = term_to_binop_type(a->array[1]->token.token_type);
-        if(assemble_ast(right_analysis, &(*node)->binop.right, sen, depth) != E_OK) {
-            return E_INT;
-        }
-        if(assemble_ast(right_analysis, &(*node)->binop.left, sen, depth) != E_OK) {
-            return E_INT;
-        }
-        break;
-    case RULE_ID:
-        (*node)->node_type = AST_NODE_SYMBOL;
-        (*node)->symbol.name = a->array[0]->token.string;
-        (*node)->symbol.is_declaration = true;
-        break;
-    case RULE_PARENTHESES:
-        if(assemble_ast(right_analysis, node, sen, depth)) {
-            return E_INT;
-        }
-        break;
-    case RULE_LITERAL: {
-        token_t t = a->array[0]->token;
-        switch(t.token_type) {
-        case T_INTEGER:
-            (*node)->node_type = AST_NODE_INTEGER;
-            (*node)->integer = t.integer;
-            break;
-        case T_STRING:
-            (*node)->node_type = AST_NODE_STRING;
-            (*node)->string = t.string;
-            break;
-        case T_NUMBER:
-            (*node)->node_type = AST_NODE_NUMBER;
-            (*node)->number = t.number;
-            break;
-        case T_BOOL:
-            (*node)->node_type = AST_NODE_BOOLEAN;
-            (*node)->boolean = t.boolean;
-            break;
-        case T_NIL:
-            (*node)->node_type = AST_NODE_NIL;
-            break;
-        default:
-            return E_INT;
-        }
-    } break;
-    case RULE_FUNC_CALL:
-        (*node) = (ast_node_t *) a->array[0];
-        break;
-    }
-
-    if(a->id != RULE_FUNC_CALL) {
-        for(size_t i = 0; i < a->size; ++i) {
-            stack_element_t *e = a->array[i];
-            free(e);
-        }
-    }
-
-    free(a);
-    return E_OK;
-}
-
 static int depth_c = 0;
 int precedence_parse(ast_node_t **root)
 {
-
-    adt_stack_t right_analysis;
-    if(stack_create(&right_analysis, 8) != E_OK) {
-        return E_INT;
-    }
-
-    deque_t stack;
-    deque_create(&stack);
+    stack_element_t buffer[PREC_STACK_INLINE_LENGTH];
+    prec_stack_t stack;
+    prec_stack_create_buffer(&stack, buffer, PREC_STACK_INLINE_LENGTH);
     int depth = depth_c;
     depth_c++;
 
-    stack_element_t *sentinel = malloc(sizeof(stack_element_t));
-    sentinel->type = FLAG_TERM;
-    sentinel->mark = false;
-    sentinel->token.token_type = T_EOF;
-
-    if(deque_push_front(&stack, sentinel) != E_OK) {
-        free(sentinel);
-        free_parser_bottom_up(&stack, &right_analysis, sentinel);
-        return E_INT;
-    }
+    stack_element_t sentinel = { .token.token_type = T_EOF, .type = FLAG_TERM };
+    prec_stack_push(&stack, sentinel);
 
     DPRINT(6, ">> Switch to BOTTOM UP (precedence start)\n");
 
     int r;
     token_t current;
-    r = parse_loop(&stack, &right_analysis, depth, sentinel, &current);
+    r = parse_loop(&stack, depth, &current);
 
     // DPRINT("Precedence parse end. [%d]\n", r);
     if(r == E_OK) {
         DPRINT(5, "Parse successful\n");
 
-        DPRINT(5, "Analysis: {\n");
-
-        assemble_ast(&right_analysis, root, sentinel, depth);
-
-        DPRINT(5, "}\n");
-
+        // the last reduced nonterminal is the only one left above the sentinel
+        stack_element_t *e = prec_stack_top(&stack);
+        if(e->type == FLAG_NONTERM) {
+            *root = e->node;
+        }
     } else if(r == E_SEM) {
-        fprintf(stderr, "parser: error%d:%d: couldn't parse expression.\n", current.row,
-                current.column);
+        source_position_t position = token_position(&current);
+        fprintf(stderr, "parser: error%zu:%zu: couldn't parse expression.\n", position.row,
+                position.column);
     }
 
-    free_parser_bottom_up(&stack, &right_analysis, sentinel);
+    prec_stack_free(&stack);
     DPRINT(6, "<< Switch to TOP DOWN (precedence end)\n");
     return r;
 }
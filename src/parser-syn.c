@@ -25,9 +25,13 @@
 #include "symtable.h"
 #include "error.h"
 #include "semantics.h"
+#include "typed_stack.h"
 
 #define alloc_error() fprintf(stderr, "error: not enough memory\n");
 
+/// parse stack frames held in parse() frame before the stack moves to the heap
+#define PARSE_STACK_INLINE_LENGTH 64
+
 static ast_node_t **node_list_append(ast_node_list_t *node_list, ast_node_t *node)
 {
     while(*node_list) {
@@ -43,39 +47,40 @@ static ast_node_t **node_list_tail(ast_node_list_t *node_list)
     }
     return node_list;
 }
-static ast_node_t *alloc_symbol_node(string_t id)
+static ast_node_t *alloc_symbol_node(str_view_t id)
 {
-    ast_node_t *node = calloc(1, sizeof(ast_node_t));
+    ast_node_t *node = ast_alloc_node(AST_NODE_SYMBOL);
     if(node == NULL) {
         alloc_error();
         return NULL;
     }
-    node->node_type = AST_NODE_SYMBOL;
 
     // other attributes will be filled in later
     node->symbol.is_declaration = true;
-    node->symbol.name = id;
+    node->symbol.name = atom_intern(id.ptr, id.length);
+    if(node->symbol.name == NULL) {
+        alloc_error();
+        return NULL;
+    }
     return node;
 }
 static ast_node_t *alloc_type_node(type_t type)
 {
-    ast_node_t *node = calloc(1, sizeof(ast_node_t));
+    ast_node_t *node = ast_alloc_node(AST_NODE_TYPE);
     if(node == NULL) {
         alloc_error();
         return NULL;
     }
-    node->node_type = AST_NODE_TYPE;
     node->type = type;
     return node;
 }
 static ast_node_t *alloc_break_node()
 {
-    ast_node_t *node = calloc(1, sizeof(ast_node_t));
+    ast_node_t *node = ast_alloc_node(AST_NODE_BREAK);
     if(node == NULL) {
         alloc_error();
         return NULL;
     }
-    node->node_type = AST_NODE_BREAK;
     return node;
 }
 
@@ -109,7 +114,11 @@ static int put_term(ast_node_t **root, token_t token, nterm_type_t parent_nterm,
     case T_STRING:
         switch(parent_nterm) {
         case NT_PROGRAM:
-            (*root)->program.require = token.string;
+            if(ast_alloc_string(token.lexeme.ptr, token.lexeme.length,
+                                &(*root)->program.require)) {
+                alloc_error();
+                return E_INT;
+            }
             break;
         default:
             error = true;
@@ -118,34 +127,50 @@ static int put_term(ast_node_t **root, token_t token, nterm_type_t parent_nterm,
     case T_IDENTIFIER:
         switch(parent_nterm) {
         case NT_FUNC_CALL:
-            (*root)->func_call.name = token.string;
+            (*root)->func_call.name = atom_intern(token.lexeme.ptr, token.lexeme.length);
+            if((*root)->func_call.name == NULL) {
+                alloc_error();
+                return E_INT;
+            }
             break;
         case NT_FUNC_DECL:
-            (*root)->func_decl.name = token.string;
+            (*root)->func_decl.name = atom_intern(token.lexeme.ptr, token.lexeme.length);
+            if((*root)->func_decl.name == NULL) {
+                alloc_error();
+                return E_INT;
+            }
             break;
         case NT_FUNC_DEF:
-            (*root)->func_def.name = token.string;
+            (*root)->func_def.name = atom_intern(token.lexeme.ptr, token.lexeme.length);
+            if((*root)->func_def.name == NULL) {
+                alloc_error();
+                return E_INT;
+            }
             break;
         // how do we handle scopes again?
         case NT_FOR_LOOP:
-            (*root)->for_loop.iterator = alloc_symbol_node(token.string);
+            (*root)->for_loop.iterator = alloc_symbol_node(token.lexeme);
             if((*root)->for_loop.iterator == NULL) {
                 return E_INT;
             }
             break;
         case NT_IDENTIFIER_WITH_TYPE:
-            if((new_node = alloc_symbol_node(token.string)) == NULL) {
+            if((new_node = alloc_symbol_node(token.lexeme)) == NULL) {
                 return E_INT;
             }
             last_root = node_list_append(root, new_node);
             break;
         case NT_DECLARATION:
-            (*root)->declaration.symbol.name = token.string;
+            (*root)->declaration.symbol.name = atom_intern(token.lexeme.ptr, token.lexeme.length);
+            if((*root)->declaration.symbol.name == NULL) {
+                alloc_error();
+                return E_INT;
+            }
             (*root)->declaration.symbol.is_declaration = true;
             break;
         case NT_IDENTIFIER_LIST:
         case NT_IDENTIFIER_LIST2:
-            if((new_node = alloc_symbol_node(token.string)) == NULL) {
+            if((new_node = alloc_symbol_node(token.lexeme)) == NULL) {
                 return E_INT;
             }
             node_list_append(root, new_node);
@@ -246,12 +271,11 @@ static int alloc_nterm(nterm_type_t nterm, ast_node_t **root, int depth)
 
     // allocate ast node
     print(depth, "alloc %s", nterm_to_readable(nterm));
-    *root = calloc(1, sizeof(ast_node_t));
+    *root = ast_alloc_node(node_type);
     if(*root == NULL) {
         alloc_error();
         return E_INT;
     }
-    (*root)->node_type = node_type;
     return E_OK;
 }
 
@@ -374,7 +398,27 @@ static ast_node_t **get_node_ref(ast_node_t **root, nterm_type_t nterm, int dept
     return NULL;
 }
 
-int parse(nterm_type_t nterm, ast_node_t **root, int depth)
+/**
+ * @brief Expansion of a nterm in progress, a frame of the explicit parse stack.
+ */
+typedef struct {
+    nterm_type_t nterm;
+    ast_node_t **root;  ///< AST node of the nterm
+    exp_list_t exp_list;
+    uint8_t next;       ///< index of the next nut of exp_list
+    bool child_pending; ///< the nut at next is a nterm which is being expanded
+} parse_frame_t;
+
+DEFINE_STACK(parse_stack, parse_frame_t)
+
+/**
+ * @brief Chooses expansion of nterm by the following token and pushes its frame.
+ *
+ * Expressions are handed over to the precedence parser and parsed whole, no frame is pushed.
+ *
+ * @return E_SYN if there is no expansion, E_INT on allocation error, otherwise E_OK
+ */
+static int expand(parse_stack_t *stack, nterm_type_t nterm, ast_node_t **root, int depth)
 {
     int err;
 
@@ -387,55 +431,79 @@ int parse(nterm_type_t nterm, ast_node_t **root, int depth)
 
     // peek at token
     token_t token;
-    if((err = get_next_token(&token))) {
+    if((err = peek_token(0, &token))) {
         return err;
     }
 
-    // handle func-call special case
+    // handle func-call special case, both start with the already read identifier
     if(nterm == NT_PAREN_EXP_LIST_OR_ID_LIST2) {
-        unget_token();
         unget_token();
         if(token.token_type == T_LPAREN) {
-            return parse(NT_FUNC_CALL, root, depth);
+            return expand(stack, NT_FUNC_CALL, root, depth);
         } else if(token.token_type == T_COMMA || token.token_type == T_EQUALS) {
-            return parse(NT_ASSIGNMENT, root, depth);
+            return expand(stack, NT_ASSIGNMENT, root, depth);
         }
     }
 
     // get expansion list from nterm and following token
-    exp_list_t exp_list = table->data[parser_get_table_index(nterm, token.token_type)];
+    exp_list_t exp_list = parser_table[nterm][token.token_type];
     if(!exp_list.valid) {
         // invalid rule
-        fprintf(stderr, "error:%d:%d: parser: unexpected token \"%s\" (expanding \"%s\")\n",
-                token.row, token.column, term_to_readable(token.token_type),
+        source_position_t position = token_position(&token);
+        fprintf(stderr, "error:%zu:%zu: parser: unexpected token \"%s\" (expanding \"%s\")\n",
+                position.row, position.column, term_to_readable(token.token_type),
                 nterm_to_readable(nterm));
         return E_SYN;
     }
 
     print(depth, "(%s, %s)", nterm_to_readable(nterm), term_to_readable(token.token_type));
 
-    // put token back
-    unget_token();
-
     if((err = alloc_nterm(nterm, root, depth))) {
         return err;
     }
 
-    // loop over expansions
-    for(size_t i = 0; i < exp_list.size; i++) {
+    parse_frame_t frame = { .nterm = nterm, .root = root, .exp_list = exp_list };
+    if(parse_stack_push(stack, frame) != E_OK) {
+        alloc_error();
+        return E_INT;
+    }
+    return E_OK;
+}
+
+int parse(nterm_type_t nterm, ast_node_t **root, int depth)
+{
+    parse_frame_t buffer[PARSE_STACK_INLINE_LENGTH];
+    parse_stack_t stack;
+    parse_stack_create_buffer(&stack, buffer, PARSE_STACK_INLINE_LENGTH);
+
+    int err = expand(&stack, nterm, root, depth);
+    while(!err && stack.size) {
+        parse_frame_t *frame = parse_stack_top(&stack);
+        int frame_depth = depth + (int) stack.size - 1;
 
-        nut_type_t expected = exp_list.data[i];
+        if(frame->next == frame->exp_list.size) {
+            stack.size--;
+            continue;
+        }
+        nut_type_t expected = parser_rules[frame->exp_list.offset + frame->next];
 
-        // call recursively if nterm
-        if(expected.is_nterm) {
-            ast_node_t **ref = get_node_ref(root, nterm, depth);
-            if((err = parse(expected.nterm, ref, depth + 1))) {
-                return err;
+        if(expected.is_nterm && !frame->child_pending) {
+            // descend, the frame continues once the child is expanded
+            ast_node_t **ref = get_node_ref(frame->root, frame->nterm, frame_depth);
+            frame->child_pending = true;
+            size_t size = stack.size;
+            if((err = expand(&stack, expected.nterm, ref, frame_depth + 1))) {
+                break;
+            }
+            if(stack.size != size) {
+                continue;
             }
-        } else {
+            // expression was parsed without a frame, the stack didn't move
+        } else if(!expected.is_nterm) {
             // try to following token with the expected one
+            token_t token;
             if((err = get_next_token(&token))) {
-                return err;
+                break;
             }
 
             // this parser expects `nil` only as a type
@@ -445,23 +513,27 @@ int parse(nterm_type_t nterm, ast_node_t **root, int depth)
             }
 
             if(token.token_type != expected.term) {
-                fprintf(stderr, "error:%d:%d: parser: expected \"%s\" but got \"%s\"\n", token.row,
-                        token.column, term_to_readable(expected.term),
+                source_position_t position = token_position(&token);
+                fprintf(stderr, "error:%zu:%zu: parser: expected \"%s\" but got \"%s\"\n",
+                        position.row, position.column, term_to_readable(expected.term),
                         term_to_readable(token.token_type));
-                return E_SYN;
-            } else {
-                if((err = put_term(root, token, nterm, depth))) {
-                    return err;
-                }
+                err = E_SYN;
+                break;
+            }
+            if((err = put_term(frame->root, token, frame->nterm, frame_depth))) {
+                break;
             }
         }
 
-        int r = sem_check(*root, i, expected);
-        if(r != E_OK) {
-            return r;
+        frame->child_pending = false;
+        if((err = sem_check(*frame->root, frame->next, expected))) {
+            break;
         }
+        frame->next++;
     }
-    return E_OK;
+
+    parse_stack_free(&stack);
+    return err;
 }
 
 static void print_ast_list(int depth, ast_node_list_t list)
@@ -480,7 +552,7 @@ void print_ast(int depth, ast_node_t *root)
     case AST_NODE_FUNC_DECL:
         print(depth, "func-decl:");
         print(depth + 1, "name:");
-        print(depth + 2, "%s", "root->func_decl.name.ptr");
+        print(depth + 2, "%s", root->func_decl.name->str);
         print(depth + 1, "return_types:");
         print_ast_list(depth + 2, root->func_decl.return_types);
         print(depth + 1, "argument_types:");
@@ -489,7 +561,7 @@ void print_ast(int depth, ast_node_t *root)
     case AST_NODE_FUNC_DEF:
         print(depth, "func-def:");
         print(depth + 1, "name:");
-        print(depth + 2, "%s", "root->func_def.name.ptr");
+        print(depth + 2, "%s", root->func_def.name->str);
         print(depth + 1, "return_types:");
         print_ast_list(depth + 2, root->func_def.return_types);
         print(depth + 1, "arguments:");
@@ -499,7 +571,7 @@ void print_ast(int depth, ast_node_t *root)
     case AST_NODE_FUNC_CALL:
         print(depth, "func-call:");
         print(depth + 1, "name:");
-        print(depth + 2, "%s", "root->func_call.name.ptr");
+        print(depth + 2, "%s", root->func_call.name->str);
         print(depth + 1, "arguments:");
         print_ast_list(depth + 2, root->func_call.arguments);
         break;
@@ -511,7 +583,7 @@ void print_ast(int depth, ast_node_t *root)
                                 ? root->declaration.symbol
                                 : *root->declaration.symbol.declaration;
         (void) sym_decl;
-        print(depth, "sym: %s: %s", sym_decl.name.ptr, type_to_readable(sym_decl.type));
+        print(depth, "sym: %s: %s", sym_decl.name->str, type_to_readable(sym_decl.type));
         if(root->declaration.assignment) {
             print(depth + 1, "assign:");
             print_ast(depth + 2, root->declaration.assignment);
@@ -609,7 +681,7 @@ void print_ast(int depth, ast_node_t *root)
         break;
     case AST_NODE_SYMBOL:;
         symbol_t sym = (root->symbol.is_declaration) ? root->symbol : *root->symbol.declaration;
-        print(depth, "sym: (%s: %s)", sym.name.ptr, type_to_readable(sym.type));
+        print(depth, "sym: (%s: %s)", sym.name->str, type_to_readable(sym.type));
         (void) sym;
         break;
     case AST_NODE_STRING:
@@ -623,93 +695,3 @@ void print_ast(int depth, ast_node_t *root)
         break;
     }
 }
-void free_ast(ast_node_t *root)
-{
-    if(root == NULL) {
-        return;
-    }
-    switch(root->node_type) {
-    case AST_NODE_PROGRAM:
-        str_free(&root->program.require);
-        free_ast(root->program.global_statement_list);
-        break;
-    case AST_NODE_FUNC_DECL:
-        str_free(&root->func_decl.name);
-        free_ast(root->func_decl.argument_types);
-        free_ast(root->func_decl.return_types);
-        break;
-    case AST_NODE_FUNC_DEF:
-        str_free(&root->func_def.name);
-        free_ast(root->func_def.arguments);
-        free_ast(root->func_def.return_types);
-        free_ast(root->func_def.body);
-        break;
-    case AST_NODE_FUNC_CALL:
-        str_free(&root->func_call.name);
-        free_ast(root->func_call.arguments);
-        break;
-    case AST_NODE_DECLARATION:
-        // can't we just store the symbol in an AST node?
-        if(root->symbol.is_declaration) {
-            str_free(&root->symbol.name);
-            // str_free(&root->symbol.suffix);
-        }
-        free_ast(root->declaration.assignment);
-        break;
-    case AST_NODE_ASSIGNMENT:
-        free_ast(root->assignment.identifiers);
-        free_ast(root->assignment.expressions);
-        break;
-    case AST_NODE_BODY:
-        free_ast(root->body.statements);
-        break;
-    case AST_NODE_IF:
-        free_ast(root->if_condition.conditions);
-        free_ast(root->if_condition.bodies);
-        break;
-    case AST_NODE_WHILE:
-        free_ast(root->while_loop.condition);
-        free_ast(root->while_loop.body);
-        break;
-    case AST_NODE_REPEAT:
-        free_ast(root->repeat_loop.condition);
-        free_ast(root->repeat_loop.body);
-        break;
-    case AST_NODE_FOR:
-        free_ast(root->for_loop.iterator);
-        free_ast(root->for_loop.setup);
-        free_ast(root->for_loop.condition);
-        free_ast(root->for_loop.step);
-        free_ast(root->for_loop.body);
-        break;
-    case AST_NODE_RETURN:
-        free_ast(root->return_values.values);
-        break;
-    case AST_NODE_SYMBOL:
-        if(root->symbol.is_declaration) {
-            str_free(&root->symbol.name);
-        }
-        break;
-    case AST_NODE_STRING:
-        str_free(&root->string);
-        break;
-    case AST_NODE_BINOP:
-        free_ast(root->binop.left);
-        free_ast(root->binop.right);
-        break;
-    case AST_NODE_UNOP:
-        free_ast(root->unop.operand);
-        break;
-    case AST_NODE_BREAK:
-    case AST_NODE_TYPE:
-    case AST_NODE_INTEGER:
-    case AST_NODE_NUMBER:
-    case AST_NODE_BOOLEAN:
-    case AST_NODE_NIL:
-    case AST_NODE_INVALID:
-        break;
-    }
-
-    free_ast(root->next);
-    free(root);
-}
@@ -0,0 +1,267 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file scanner-number.c
+ *
+ * @brief Conversion of number lexemes straight from the source buffer
+ */
+#include "scanner-number.h"
+#include "scanner-pow5.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// number lexemes up to this length are passed to strtod() without allocating
+#define NUMBER_BUFFER_LENGTH 64
+/// significant digits which always fit uint64_t
+#define MAX_DIGITS 19
+/// explicit exponents are not accumulated past this, the result is zero or infinity anyway
+#define MAX_EXPONENT 100000
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+#if FLT_EVAL_METHOD == 0
+/// powers of ten represented exactly by double
+static const double exact_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#endif
+
+static inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+int parse_integer(const char *p, const char *end, int64_t *value)
+{
+    if(p == end) {
+        return 1;
+    }
+
+    uint64_t v = 0;
+    // up to 18 digits can't overflow, check only longer lexemes
+    if(end - p < MAX_DIGITS) {
+        for(; p < end; p++) {
+            unsigned d = (unsigned char) *p - '0';
+            if(d > 9) {
+                return 1;
+            }
+            v = v * 10 + d;
+        }
+    } else {
+        for(; p < end; p++) {
+            unsigned d = (unsigned char) *p - '0';
+            if(d > 9 || v > ((uint64_t) INT64_MAX - d) / 10) {
+                return 1;
+            }
+            v = v * 10 + d;
+        }
+    }
+    *value = (int64_t) v;
+    return 0;
+}
+
+/**
+ * Parses lexeme with strtod(), used when the digits don't fit or Eisel-Lemire can't decide.
+ */
+static int strtod_fallback(const char *p, const char *end, double *value)
+{
+    size_t length = end - p;
+    char buffer[NUMBER_BUFFER_LENGTH];
+    char *s = buffer;
+    if(length >= NUMBER_BUFFER_LENGTH) {
+        s = malloc(length + 1);
+        if(!s) {
+            return 1;
+        }
+    }
+    memcpy(s, p, length);
+    s[length] = '\0';
+
+    char *stop = NULL;
+    *value = strtod(s, &stop);
+    int ret = *stop != '\0';
+    if(s != buffer) {
+        free(s);
+    }
+    return ret;
+}
+
+/**
+ * Computes the full 128-bit product of a and b.
+ */
+static inline void multiply(uint64_t a, uint64_t b, uint64_t *lo, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+    uint128_t r = (uint128_t) a * b;
+    *lo = (uint64_t) r;
+    *hi = (uint64_t)(r >> 64);
+#else
+    uint64_t a_lo = (uint32_t) a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t) b, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32) + (uint32_t) lh + (uint32_t) hl;
+    *lo = (mid << 32) | (uint32_t) ll;
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/**
+ * Computes the double nearest to w * 10^q using the Eisel-Lemire algorithm.
+ *
+ * @param w nonzero decimal significand
+ * @param q decimal exponent between POW5_MIN_EXPONENT and POW5_MAX_EXPONENT
+ * @param[out] value correctly rounded result
+ * @return 0 on success, 1 if the truncated power of five doesn't decide the rounding
+ */
+static int eisel_lemire(uint64_t w, int q, double *value)
+{
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    // 55 significant bits are enough unless the truncated product ends with all ones
+    const uint64_t *pow5 = pow5_table[q - POW5_MIN_EXPONENT];
+    uint64_t lo, hi;
+    multiply(w, pow5[0], &lo, &hi);
+    if((hi & 0x1ff) == 0x1ff) {
+        uint64_t lo2, hi2;
+        multiply(w, pow5[1], &lo2, &hi2);
+        lo += hi2;
+        if(hi2 > lo) {
+            hi++;
+        }
+    }
+    if(lo == UINT64_MAX && (q < -27 || q > 55)) {
+        return 1;
+    }
+
+    int upperbit = (int) (hi >> 63);
+    int shift = upperbit + 64 - DBL_MANT_DIG - 2;
+    uint64_t mantissa = hi >> shift;
+    // floor(log2(10^q)) + 63, biased
+    int power2 = ((217706 * q) >> 16) + 63 + upperbit - lz + 1023;
+
+    if(power2 <= 0) {
+        // subnormal, or rounds up to the smallest normal
+        if(-power2 + 1 >= 64) {
+            *value = 0.0;
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (1ULL << (DBL_MANT_DIG - 1)) ? 0 : 1;
+    } else {
+        // exactly halfway between two doubles, round to even
+        if(lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi) {
+            mantissa &= ~1ULL;
+        }
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        if(mantissa >= (2ULL << (DBL_MANT_DIG - 1))) {
+            mantissa = 1ULL << (DBL_MANT_DIG - 1);
+            power2++;
+        }
+        mantissa &= ~(1ULL << (DBL_MANT_DIG - 1));
+        if(power2 >= 0x7ff) {
+            *value = HUGE_VAL;
+            return 0;
+        }
+    }
+
+    uint64_t bits = mantissa | (uint64_t) power2 << (DBL_MANT_DIG - 1);
+    memcpy(value, &bits, sizeof(bits));
+    return 0;
+}
+
+int parse_decimal(const char *p, const char *end, double *value)
+{
+    const char *start = p;
+    uint64_t w = 0;
+    int digits = 0;
+    int64_t q = 0;
+    bool truncated = false;
+
+    if(p == end || !is_digit(*p)) {
+        return 1;
+    }
+    for(; p < end && is_digit(*p); p++) {
+        if(digits < MAX_DIGITS) {
+            w = w * 10 + (*p - '0');
+            digits += w != 0;
+        } else {
+            truncated |= *p != '0';
+            q++;
+        }
+    }
+    if(p < end && *p == '.') {
+        for(p++; p < end && is_digit(*p); p++) {
+            if(digits < MAX_DIGITS) {
+                w = w * 10 + (*p - '0');
+                digits += w != 0;
+                q--;
+            } else {
+                truncated |= *p != '0';
+            }
+        }
+    }
+    if(p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negative = p < end && *p == '-';
+        if(p < end && (*p == '-' || *p == '+')) {
+            p++;
+        }
+        if(p == end || !is_digit(*p)) {
+            return 1;
+        }
+        int64_t e = 0;
+        for(; p < end && is_digit(*p); p++) {
+            if(e < MAX_EXPONENT) {
+                e = e * 10 + (*p - '0');
+            }
+        }
+        q += negative ? -e : e;
+    }
+    if(p != end) {
+        return 1;
+    }
+
+    if(truncated) {
+        return strtod_fallback(start, end, value);
+    }
+    if(w == 0 || q < POW5_MIN_EXPONENT) {
+        *value = 0.0;
+        return 0;
+    }
+    if(q > POW5_MAX_EXPONENT) {
+        *value = HUGE_VAL;
+        return 0;
+    }
+
+#if FLT_EVAL_METHOD == 0
+    // both operands are exact, so a single rounded operation gives the correct result
+    if(q >= -22 && q <= 22 && w <= (1ULL << DBL_MANT_DIG)) {
+        double d = (double) w;
+        *value = q < 0 ? d / exact_pow10[-q] : d * exact_pow10[q];
+        return 0;
+    }
+#endif
+
+    if(eisel_lemire(w, (int) q, value)) {
+        return strtod_fallback(start, end, value);
+    }
+    return 0;
+}
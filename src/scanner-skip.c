@@ -0,0 +1,162 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file scanner-skip.c
+ *
+ * @brief Vectorized skipping of whitespace, comment and string bodies
+ */
+#include "scanner-skip.h"
+
+#include <stdbool.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static inline bool is_space(unsigned char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+#if defined(__AVX2__)
+
+const char *skip_spaces(const char *p, const char *end)
+{
+    // most tokens are separated by a single space, don't set up vectors for nothing
+    if(p < end && !is_space(*p)) {
+        return p;
+    }
+
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i range = _mm256_set1_epi8('\r' - '\t');
+
+    while(end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) p);
+        // '\t' <= c <= '\r' as unsigned c - '\t' <= '\r' - '\t'
+        __m256i offset = _mm256_sub_epi8(v, tab);
+        __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, range), offset);
+        __m256i spaces = _mm256_or_si256(_mm256_cmpeq_epi8(v, space), control);
+        unsigned mask = ~(unsigned) _mm256_movemask_epi8(spaces);
+        if(mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+    while(p < end && is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+const char *skip_to_any(const char *p, const char *end, char a, char b, char c)
+{
+    if(p < end && (*p == a || *p == b || *p == c)) {
+        return p;
+    }
+
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+    const __m256i vc = _mm256_set1_epi8(c);
+
+    while(end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) p);
+        __m256i stop = _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb));
+        stop = _mm256_or_si256(stop, _mm256_cmpeq_epi8(v, vc));
+        unsigned mask = (unsigned) _mm256_movemask_epi8(stop);
+        if(mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+    while(p < end && *p != a && *p != b && *p != c) {
+        p++;
+    }
+    return p;
+}
+
+#elif defined(__SSE2__)
+
+const char *skip_spaces(const char *p, const char *end)
+{
+    // most tokens are separated by a single space, don't set up vectors for nothing
+    if(p < end && !is_space(*p)) {
+        return p;
+    }
+
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i range = _mm_set1_epi8('\r' - '\t');
+
+    while(end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *) p);
+        // '\t' <= c <= '\r' as unsigned c - '\t' <= '\r' - '\t'
+        __m128i offset = _mm_sub_epi8(v, tab);
+        __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(offset, range), offset);
+        __m128i spaces = _mm_or_si128(_mm_cmpeq_epi8(v, space), control);
+        unsigned mask = ~(unsigned) _mm_movemask_epi8(spaces) & 0xffff;
+        if(mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+    while(p < end && is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+const char *skip_to_any(const char *p, const char *end, char a, char b, char c)
+{
+    if(p < end && (*p == a || *p == b || *p == c)) {
+        return p;
+    }
+
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+
+    while(end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *) p);
+        __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb));
+        stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, vc));
+        unsigned mask = (unsigned) _mm_movemask_epi8(stop);
+        if(mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+    while(p < end && *p != a && *p != b && *p != c) {
+        p++;
+    }
+    return p;
+}
+
+#else
+
+const char *skip_spaces(const char *p, const char *end)
+{
+    while(p < end && is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+const char *skip_to_any(const char *p, const char *end, char a, char b, char c)
+{
+    while(p < end && *p != a && *p != b && *p != c) {
+        p++;
+    }
+    return p;
+}
+
+#endif
@@ -12,171 +12,131 @@
  *
  * @brief Lexical analysis tool
  */
+#define _POSIX_C_SOURCE 200809L
 
 #include "scanner.h"
+#include "scanner-keywords.h"
+#include "scanner-number.h"
+#include "scanner-table.h"
+#include "scanner-skip.h"
+#include "source.h"
+#include "typed_stack.h"
 #include "parser-generated.h"
 #include "type.h"
 #include "string.h"
-#include <ctype.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <unistd.h>
 
-typedef enum
-{
-    SCANNER_STATE_START,              ///> Starting state, where scanner returns after every token
-    SCANNER_STATE_KEYWORD_IDENTIFIER, ///> State for a possible identifier or reserved keyword
-    SCANNER_STATE_NUMBER,             ///> State for reading integer digits
-    SCANNER_STATE_DECIMAL,            ///> State for decimal digits
-    SCANNER_STATE_EXPONENT,           ///> State for "e" or "E"
-    SCANNER_STATE_EXPONENT_VALUE,     ///> State for exponent value, ONLY integer exponent value is
-                                      /// accepted
-
-    SCANNER_STATE_COMMENT_DASH_1, ///> State for the first dash at the beginning of commentary
-    SCANNER_STATE_COMMENT_DASH_2, ///> State for the second dash at the beginning of commentary
-    SCANNER_STATE_INLINE_COMMENT,
-    SCANNER_STATE_BLOCK_COMMENT_BRACKET, ///> State for the first square opening bracket
-    SCANNER_STATE_BLOCK_COMMENT,         ///> State for insides of block comment to ignore
-    SCANNER_STATE_CLOSING_BRACKET,       ///> State for the first closing bracket of block comment
-
-    SCANNER_STATE_STRING,          ///> State for reading string
-    SCANNER_STATE_ESCAPE_CHAR_SEQ, ///> State for reading escape character or first digit from
-                                   /// escape decimal sequence
-    SCANNER_STATE_ESCAPE_SEQ_1,    ///> State for reading second degit from escape decimal sequence
-    SCANNER_STATE_ESCAPE_SEQ_2,    ///> State for reading third degit from escape decimal sequence
-
-    SCANNER_STATE_DOT,          ///> State for the first '.' at the beginning of '..' operator
-    SCANNER_STATE_LESS_THAN,    ///> State for '<' at the beginning of '<=' operator
-    SCANNER_STATE_GREATER_THAN, ///> State for the first '=' at the beginning of '==' operator
-    SCANNER_STATE_EQUALS,       ///> State for '>' at the beginning of '>=' operator
-    SCANNER_STATE_TILDE,        ///> State for '~' at the beginning of '~=' operator
-    SCANNER_STATE_SLASH         ///> State for '/' at the beginning of '//' operator
-
-} scanner_state;
+/// initial length of the token array
+#define TOKEN_ARRAY_LENGTH 1024
+/// tokens handed over from the lexer thread at once
+#define TOKEN_BATCH_LENGTH 256
+/// batches in the pipeline ring, has to be a power of two
+#define TOKEN_RING_LENGTH 16
+
+/**
+ * @brief Tokens lexed by the lexer thread, published as a whole
+ */
+typedef struct {
+    token_t tokens[TOKEN_BATCH_LENGTH]; ///< lexed tokens
+    size_t count;                       ///< number of tokens in batch
+    bool last;                          ///< batch ends with T_EOF or a lexical error
+    int result;                         ///< result of lexing the last token in batch
+} token_batch_t;
+
+/**
+ * @brief Single-producer/single-consumer ring between the lexer thread and the parser
+ *
+ * Counters are guarded by lock, a side that has to wait sleeps on a condition variable.
+ */
+static struct {
+    token_batch_t *batches;   ///< TOKEN_RING_LENGTH batches, NULL if lexing on the parser thread
+    size_t head;              ///< number of batches published by the lexer thread
+    size_t tail;              ///< number of batches taken by the parser
+    bool stop;                ///< parser is done, the lexer thread should quit
+    pthread_mutex_t lock;     ///< guards head, tail and stop
+    pthread_cond_t not_empty; ///< signalled when the lexer thread publishes a batch
+    pthread_cond_t not_full;  ///< signalled when the parser takes a batch or stops the thread
+    pthread_t thread;         ///< lexer thread
+} ring = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .not_empty = PTHREAD_COND_INITIALIZER,
+    .not_full = PTHREAD_COND_INITIALIZER,
+};
+
+DEFINE_STACK(char_stack, char *)
 
 static FILE *fptr;
-static token_t last_tokens[TOKEN_BUF_LENGTH];
-static short unsigned last_token_ix = 0;
-static int row, column;
+static source_t source;
+static const char *cursor;
+static const char *source_end;
+static char_stack_t materialized; ///< string literals with processed escape sequences
+static token_t *tokens;       ///< tokens lexed so far, get_next_token() reads them in order
+static size_t token_count;    ///< number of tokens in tokens
+static size_t token_capacity; ///< number of tokens allocated
+static size_t token_ix;       ///< index of the token returned by the next get_next_token()
+static bool lex_done;         ///< last token in tokens is T_EOF or a lexical error
+static int lex_result;        ///< result of lexing the last token in tokens
 
 /**
  * Identifies keyword.
  *
  *
+ * @param lexeme View of identifier name or reserved keyword in the source.
  * @param[out] t Pointer token, to which attributes are assigned
- * @param str Pointer to string containing identifier name or reserved keyword.
  */
-static void identify_keyword(string_t *str, token_t *t)
+static void identify_keyword(str_view_t lexeme, token_t *t)
 {
-    if(!strcmp(str->ptr, "if")) {
-        t->token_type = T_IF;
-
-    } else if(!strcmp(str->ptr, "else")) {
-        t->token_type = T_ELSE;
-
-    } else if(!strcmp(str->ptr, "do")) {
-        t->token_type = T_DO;
-
-    } else if(!strcmp(str->ptr, "end")) {
-        t->token_type = T_END;
-
-    } else if(!strcmp(str->ptr, "function")) {
-        t->token_type = T_FUNCTION;
-
-    } else if(!strcmp(str->ptr, "global")) {
-        t->token_type = T_GLOBAL;
-
-    } else if(!strcmp(str->ptr, "nil")) {
-        t->token_type = T_NIL;
-
-    } else if(!strcmp(str->ptr, "require")) {
-        t->token_type = T_REQUIRE;
-
-    } else if(!strcmp(str->ptr, "return")) {
-        t->token_type = T_RETURN;
-
-    } else if(!strcmp(str->ptr, "while")) {
-        t->token_type = T_WHILE;
-
-    } else if(!strcmp(str->ptr, "then")) {
-        t->token_type = T_THEN;
-
-    } else if(!strcmp(str->ptr, "integer")) {
-        t->token_type = T_TYPE;
-        t->type = TYPE_INTEGER;
-
-    } else if(!strcmp(str->ptr, "number")) {
-        t->token_type = T_TYPE;
-        t->type = TYPE_NUMBER;
-
-    } else if(!strcmp(str->ptr, "local")) {
-        t->token_type = T_LOCAL;
-
-    } else if(!strcmp(str->ptr, "string")) {
-        t->token_type = T_TYPE;
-        t->type = TYPE_STRING;
-
-    } else if(!strcmp(str->ptr, "boolean")) {
-        t->token_type = T_TYPE;
-        t->type = TYPE_BOOL;
-
-    } else if(!strcmp(str->ptr, "true")) {
-        t->token_type = T_BOOL;
-        t->boolean = true;
-
-    } else if(!strcmp(str->ptr, "false")) {
-        t->token_type = T_BOOL;
-        t->boolean = false;
-
-    } else if(!strcmp(str->ptr, "elseif")) {
-        t->token_type = T_ELSEIF;
-
-    } else if(!strcmp(str->ptr, "repeat")) {
-        t->token_type = T_REPEAT;
-
-    } else if(!strcmp(str->ptr, "until")) {
-        t->token_type = T_UNTIL;
-
-    } else if(!strcmp(str->ptr, "break")) {
-        t->token_type = T_BREAK;
-
-    } else if(!strcmp(str->ptr, "not")) {
-        t->token_type = T_NOT;
-
-    } else if(!strcmp(str->ptr, "and")) {
-        t->token_type = T_AND;
-
-    } else if(!strcmp(str->ptr, "or")) {
-        t->token_type = T_OR;
-    } else if(!strcmp(str->ptr, "for")) {
-        t->token_type = T_FOR;
-    } else {
+    const keyword_t *keyword = keyword_lookup(lexeme.ptr, lexeme.length);
+    if(!keyword) {
         t->token_type = T_IDENTIFIER;
-        t->string = *str;
+        t->lexeme = lexeme;
         return;
     }
-    str_free(str);
+
+    t->token_type = keyword->token_type;
+    if(keyword->token_type == T_TYPE) {
+        t->type = keyword->value;
+    } else if(keyword->token_type == T_BOOL) {
+        t->boolean = keyword->value;
+    }
 }
 
 /**
- * Parses dynamic string to integer.
+ * Parses number lexeme to decimal.
  *
  *
- * @param[out] t Pointer to string containing integer number.
+ * @param lexeme View of the number in the source.
+ * @param[out] t Pointer to token, to which attributes are assigned
  * @return 0 on success, otherwise 1.
  */
-static int process_integer(string_t *str, token_t *t)
+static int process_decimal(str_view_t lexeme, token_t *t)
 {
-    char *p = NULL;
-    int64_t int_val = (int64_t) strtol(str->ptr, &p, 10);
-
-    if(*p) {
+    if(parse_decimal(lexeme.ptr, lexeme.ptr + lexeme.length, &t->number)) {
         return 1;
-    } else {
-        t->token_type = T_INTEGER;
-        t->integer = int_val;
-        return 0;
     }
+    t->token_type = T_NUMBER;
+    return 0;
+}
+
+/**
+ * Parses number lexeme to integer, integers which don't fit int64_t are read as decimals.
+ *
+ *
+ * @param lexeme View of digits in the source.
+ * @param[out] t Pointer to token, to which attributes are assigned
+ * @return 0 on success, otherwise 1.
+ */
+static int process_integer(str_view_t lexeme, token_t *t)
+{
+    if(parse_integer(lexeme.ptr, lexeme.ptr + lexeme.length, &t->integer)) {
+        return process_decimal(lexeme, t);
+    }
+    t->token_type = T_INTEGER;
+    return 0;
 }
 
 /**
@@ -186,7 +146,7 @@ static int process_integer(string_t *str, token_t *t)
  * @param str Pointer to string containing integer number.
  * @return escaped integer on success, otherwise 0.
  */
-uint16_t process_escape(char *str)
+static uint16_t process_escape(char *str)
 {
     char *p = NULL;
     unsigned short int_val = (int64_t) strtol(str, &p, 10);
@@ -202,628 +162,443 @@ uint16_t process_escape(char *str)
     }
 }
 
-/**
- * Parses dynamic string to decimal.
- *
- *
- * @param[out] t Pointer to token, to which attributes are assigned
- * @param str Pointer to string containing integer number.
- * @return 0 on success, otherwise return errno.
- */
-static int process_decimal(string_t *str, token_t *t)
+int scanner_init(FILE *source_file)
 {
-    char *p = NULL;
-    double double_val = strtod(str->ptr, &p);
+    fptr = source_file;
+    token_count = 0;
+    token_ix = 0;
+    lex_done = false;
+    lex_result = E_OK;
+    char_stack_create(&materialized);
+
+    int result = source_open(&source, source_file);
+    if(result == E_OK && char_stack_reserve(&materialized, 16)) {
+        result = E_INT;
+    }
+    // token offsets are 32-bit, such sources can't be lexed
+    if(result == E_OK && source.length > SCANNER_MAX_SOURCE_LENGTH) {
+        result = E_INT;
+    }
+    if(result != E_OK) {
+        // without source data every token request fails with E_INT
+        source_close(&source);
+    }
+    cursor = source.data;
+    source_end = source.data + source.length;
+    return result;
+}
 
-    if(*p) {
-        return 1;
-    } else {
-        t->token_type = T_NUMBER;
-        t->number = double_val;
-        return 0;
+int scanner_free(void)
+{
+    if(ring.batches) {
+        pthread_mutex_lock(&ring.lock);
+        ring.stop = true;
+        pthread_cond_signal(&ring.not_full);
+        pthread_mutex_unlock(&ring.lock);
+        pthread_join(ring.thread, NULL);
+        free(ring.batches);
+        ring.batches = NULL;
+    }
+    while(!char_stack_empty(&materialized)) {
+        free(char_stack_pop(&materialized));
+    }
+    char_stack_free(&materialized);
+    free(tokens);
+    tokens = NULL;
+    token_count = token_capacity = 0;
+    source_close(&source);
+    cursor = source_end = NULL;
+    FILE *file = fptr;
+    fptr = NULL;
+    if(file && fclose(file)) {
+        return E_INT;
     }
+    return E_OK;
 }
 
-void scanner_init(FILE *source_file)
+/**
+ * Materializes string literal read so far, called on its first escape sequence.
+ *
+ * @param[out] str Empty string loaded with chars from start to the backslash.
+ * @param start First char of the string literal.
+ * @return E_INT on allocation error, else E_OK
+ */
+static int materialize_string(string_t *str, const char *start)
 {
-    fptr = source_file;
-    last_token_ix = 0;
-    row = 1;
-    column = 0;
+    str_view_t prefix = { start, cursor - 1 - start };
+    return str_create_view(prefix, str);
 }
 
-int scanner_free(void)
+/**
+ * Skips chars which leave state unchanged and don't need any action.
+ *
+ * The stop chars are exactly those with a transition other than the default one.
+ *
+ * @param state State with a fast path, see skip_states in build_scanner.py.
+ * @param p First char to examine.
+ * @return Pointer to the first char which has to go through the table.
+ */
+static inline const char *skip_state(int state, const char *p)
 {
-    if(fclose(fptr)) {
-        return E_INT;
+    switch(state) {
+    case SCANNER_STATE_START:
+        return skip_spaces(p, source_end);
+    case SCANNER_STATE_INLINE_COMMENT:
+        return skip_to_any(p, source_end, '\n', '\n', '\n');
+    case SCANNER_STATE_BLOCK_COMMENT:
+        return skip_to_any(p, source_end, ']', ']', ']');
+    default:
+        return skip_to_any(p, source_end, '"', '\\', '\\');
     }
-    return E_OK;
 }
 
+/**
+ * Runs the DFA from scanner-table.h until a token is accepted.
+ *
+ * Every char is classified by scanner_char_class, the transition for the current state and class
+ * then tells the next state, flags and an action, which is the only place a token is built.
+ */
 static int _get_next_token(token_t *t)
 {
     // Checks if the file to be read is present
-    if(!fptr) {
+    if(!source.data) {
         return E_INT;
     }
 
-    string_t str;
-
-    // Initialises a null terminated empty string
-    if(str_create_empty(&str)) {
-        return E_INT;
-    }
+    // only numbers and strings with escape sequences are copied out of the source
+    string_t str = { .ptr = NULL };
+    const char *start = cursor;
 
     static int state = SCANNER_STATE_START;
     int c;
     char esc_mem[4] = { 0, 0, 0, '\0' };
+    int esc_ix = 0;
 
     while(true) {
 
-        c = fgetc(fptr);
-        column++;
-
-        switch(state) {
-        case SCANNER_STATE_START:
-            t->row = row;
-            t->column = column;
-            if(isspace(c)) {
-
-                state = SCANNER_STATE_START;
-
-                if(c == '\n') {
-                    row++;
-                    column = 0;
-                }
-
-            } else if(isdigit(c)) {
-
-                state = SCANNER_STATE_NUMBER;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else if(c == '<') {
-
-                state = SCANNER_STATE_LESS_THAN;
-
-            } else if(c == '>') {
+        c = cursor < source_end ? (unsigned char) *cursor++ : EOF;
 
-                state = SCANNER_STATE_GREATER_THAN;
+        const scanner_transition_t *tr =
+            &scanner_transitions[state][c == EOF ? CHAR_CLASS_EOF : scanner_char_class[c]];
+        state = tr->next;
 
-            } else if(c == '.') {
-
-                state = SCANNER_STATE_DOT;
-
-            } else if(c == '=') {
-
-                state = SCANNER_STATE_EQUALS;
-
-            } else if(c == '~') {
-
-                state = SCANNER_STATE_TILDE;
-
-            } else if(c == '%') {
-
-                str_free(&str);
-                t->token_type = T_PERCENT;
-                return E_OK;
-
-            } else if(c == '^') {
-
-                str_free(&str);
-                t->token_type = T_CARET;
-                return E_OK;
-
-            } else if(c == '+') {
-
-                str_free(&str);
-                t->token_type = T_PLUS;
-                return E_OK;
-
-            } else if(c == '*') {
-
-                str_free(&str);
-                t->token_type = T_ASTERISK;
-                return E_OK;
-
-            } else if(c == '(') {
-
-                str_free(&str);
-                t->token_type = T_LPAREN;
-                return E_OK;
-
-            } else if(c == ')') {
-
-                str_free(&str);
-                t->token_type = T_RPAREN;
-                return E_OK;
-
-            } else if(c == ':') {
-
-                str_free(&str);
-                t->token_type = T_COLON;
-                return E_OK;
-
-            } else if(c == ',') {
-
-                str_free(&str);
-                t->token_type = T_COMMA;
-                return E_OK;
-
-            } else if(c == '#') {
-
-                str_free(&str);
-                t->token_type = T_HASH;
-                return E_OK;
-
-            } else if(c == '/') {
-
-                state = SCANNER_STATE_SLASH;
-                str_free(&str);
-
-            } else if(c == '-') {
-
-                state = SCANNER_STATE_COMMENT_DASH_1;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else if(c == '"') {
-
-                state = SCANNER_STATE_STRING;
-
-            } else if(c == EOF) {
-
-                t->token_type = T_EOF;
-                str_free(&str);
-                return E_OK;
-
-            } else if(isalpha(c) || c == '_') {
-
-                state = SCANNER_STATE_KEYWORD_IDENTIFIER;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else {
-                str_free(&str);
-                return E_LEX;
+        if(tr->flags) {
+            if(tr->flags & SCANNER_FLAG_MARK) {
+                start = cursor - (c != EOF);
+                t->offset = start - source.data;
+            }
+            if((tr->flags & SCANNER_FLAG_UNREAD) && c != EOF) {
+                cursor--;
             }
+        }
 
+        switch(tr->action) {
+        case SCANNER_ACTION_NONE:
             break;
 
-        case SCANNER_STATE_NUMBER:
-            if(isdigit(c)) {
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else if(c == '.') {
-
-                state = SCANNER_STATE_DECIMAL;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else if(tolower(c) == 'e') {
-                state = SCANNER_STATE_EXPONENT;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else {
-
-                ungetc(c, fptr);
-                column--;
-
-                state = SCANNER_STATE_START;
-
-                if(process_integer(&str, t)) {
-                    str_free(&str);
-                    return E_INT;
-                } else {
-                    str_free(&str);
-                    return E_OK;
-                }
-            }
-            break;
-        case SCANNER_STATE_DECIMAL:
-            if(isdigit(c)) {
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(tolower(c) == 'e') {
+        case SCANNER_ACTION_EMIT:
+            t->token_type = tr->token;
+            return E_OK;
 
-                state = SCANNER_STATE_EXPONENT;
+        case SCANNER_ACTION_ERROR:
+            str_free(&str);
+            return E_LEX;
 
-                if(str_append_char(&str, tolower(c))) {
-                    str_free(&str);
-                    return E_INT;
-                }
+        case SCANNER_ACTION_INTEGER: {
+            str_view_t lexeme = { start, cursor - start };
+            return process_integer(lexeme, t) ? E_INT : E_OK;
+        }
 
-            } else {
-                ungetc(c, fptr);
-                column--;
+        case SCANNER_ACTION_DECIMAL: {
+            str_view_t lexeme = { start, cursor - start };
+            return process_decimal(lexeme, t) ? E_INT : E_OK;
+        }
 
-                state = SCANNER_STATE_START;
+        case SCANNER_ACTION_IDENTIFIER: {
+            str_view_t lexeme = { start, cursor - start };
+            identify_keyword(lexeme, t);
+            return E_OK;
+        }
 
-                if(process_decimal(&str, t)) {
-                    str_free(&str);
-                    return E_INT;
-                } else {
-                    str_free(&str);
-                    return E_OK;
-                }
-            }
+        case SCANNER_ACTION_STRING_OPEN:
+            start = cursor;
             break;
-        case SCANNER_STATE_EXPONENT:
-            if(c == '+' || c == '-') {
-
-                state = SCANNER_STATE_EXPONENT_VALUE;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(isdigit(c)) {
-
-                state = SCANNER_STATE_EXPONENT_VALUE;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else {
 
+        case SCANNER_ACTION_STRING_CHAR:
+            if(str.ptr && str_append_char(&str, c)) {
                 str_free(&str);
-                return E_LEX;
+                return E_INT;
             }
             break;
-        case SCANNER_STATE_EXPONENT_VALUE:
-            if(isdigit(c)) {
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-
-            } else {
-
-                ungetc(c, fptr);
-                column--;
-
-                state = SCANNER_STATE_START;
 
-                if(process_decimal(&str, t)) {
-                    str_free(&str);
+        case SCANNER_ACTION_STRING_CLOSE:
+            t->token_type = T_STRING;
+            if(str.ptr) {
+                // short strings are inline in str, which goes away on return
+                size_t length = str.length;
+                char *ptr = str_detach(&str);
+                if(!ptr || char_stack_push(&materialized, ptr)) {
+                    free(ptr);
                     return E_INT;
-                } else {
-                    str_free(&str);
-                    return E_OK;
                 }
-            }
-            break;
-        case SCANNER_STATE_DOT:
-
-            state = SCANNER_STATE_START;
-            str_free(&str);
-
-            if(c == '.') {
-                t->token_type = T_DOUBLE_DOT;
-                return E_OK;
-            } else {
-                return E_LEX;
-            }
-            break;
-
-        case SCANNER_STATE_LESS_THAN:
-
-            state = SCANNER_STATE_START;
-            str_free(&str);
-
-            if(c == '=') {
-                t->token_type = T_LTE;
-                return E_OK;
-            } else {
-                ungetc(c, fptr);
-                column--;
-                t->token_type = T_LT;
-                return E_OK;
-            }
-            break;
-
-        case SCANNER_STATE_GREATER_THAN:
-
-            state = SCANNER_STATE_START;
-            str_free(&str);
-
-            if(c == '=') {
-                t->token_type = T_GTE;
-                return E_OK;
+                t->lexeme.ptr = ptr;
+                t->lexeme.length = length;
             } else {
-                ungetc(c, fptr);
-                column--;
-                t->token_type = T_GT;
-                return E_OK;
+                t->lexeme.ptr = start;
+                t->lexeme.length = cursor - 1 - start;
             }
-            break;
-
-        case SCANNER_STATE_EQUALS:
-
-            state = SCANNER_STATE_START;
-            str_free(&str);
+            return E_OK;
 
-            if(c == '=') {
-
-                t->token_type = T_DOUBLE_EQUALS;
-                return E_OK;
-            } else {
-                ungetc(c, fptr);
-                column--;
-                t->token_type = T_EQUALS;
-                return E_OK;
-            }
-            break;
-
-        case SCANNER_STATE_TILDE:
-
-            state = SCANNER_STATE_START;
-            str_free(&str);
-
-            if(c == '=') {
-                t->token_type = T_TILDE_EQUALS;
-                return E_OK;
-            } else {
-                ungetc(c, fptr);
-                column--;
-                return E_LEX;
+        case SCANNER_ACTION_ESCAPE:
+            // first escape sequence, copy what was read so far
+            if(!str.ptr && materialize_string(&str, start)) {
+                return E_INT;
             }
+            esc_ix = 0;
             break;
 
-        case SCANNER_STATE_SLASH:
-
-            state = SCANNER_STATE_START;
-
-            if(c == '/') {
-                t->token_type = T_DOUBLE_SLASH;
-                return E_OK;
-            } else {
-                ungetc(c, fptr);
-                column--;
-                t->token_type = T_SLASH;
-                return E_OK;
-            }
-
-        case SCANNER_STATE_COMMENT_DASH_1:
-
-            if(c == '-') {
-
-                state = SCANNER_STATE_COMMENT_DASH_2;
-
-            } else {
-                ungetc(c, fptr);
-                column--;
+        case SCANNER_ACTION_ESCAPE_CHAR: {
+            char escaped = c == 'n' ? '\n' : c == 't' ? '\t' : c;
+            if(str_append_char(&str, escaped)) {
                 str_free(&str);
-                state = SCANNER_STATE_START;
-                t->token_type = T_MINUS;
-                return E_OK;
+                return E_INT;
             }
             break;
+        }
 
-        case SCANNER_STATE_COMMENT_DASH_2:
-
-            if(c == '[') {
-                state = SCANNER_STATE_BLOCK_COMMENT_BRACKET;
-            } else {
-                state = SCANNER_STATE_INLINE_COMMENT;
-            }
+        case SCANNER_ACTION_ESCAPE_DIGIT:
+            esc_mem[esc_ix++] = c;
             break;
 
-        case SCANNER_STATE_INLINE_COMMENT:
-
-            if(c == '\n') {
+        case SCANNER_ACTION_ESCAPE_CODE: {
+            esc_mem[esc_ix] = c;
+            short unsigned int val = process_escape(esc_mem);
+            if(!val) {
                 state = SCANNER_STATE_START;
-                row++;
-                column = 0;
-
-                str_free(&str);
-                str_create_empty(&str);
-            } else if(c == EOF) {
                 str_free(&str);
                 return E_LEX;
             }
-            break;
-
-        case SCANNER_STATE_BLOCK_COMMENT_BRACKET:
-
-            if(c == '[') {
-                state = SCANNER_STATE_BLOCK_COMMENT;
-
-            } else {
-                state = SCANNER_STATE_INLINE_COMMENT;
-            }
-            break;
-
-        case SCANNER_STATE_BLOCK_COMMENT:
-
-            if(c == ']') {
-                state = SCANNER_STATE_CLOSING_BRACKET;
-            } else if(c == '\n') {
-                row++;
-                column = 0;
-            } else if(c == EOF) {
+            if(str_append_char(&str, val)) {
                 str_free(&str);
-                return E_LEX;
+                return E_INT;
             }
-
             break;
-        case SCANNER_STATE_CLOSING_BRACKET:
-
-            if(c == ']') {
-                state = SCANNER_STATE_START;
+        }
+        }
 
-                str_free(&str);
-                if(str_create_empty(&str)) {
+        if(tr->flags & SCANNER_FLAG_SKIP) {
+            const char *skipped = skip_state(state, cursor);
+            if(str.ptr) {
+                str_view_t chars = { cursor, skipped - cursor };
+                if(str_append_view(&str, chars)) {
+                    str_free(&str);
                     return E_INT;
                 }
-
-            } else if(c == EOF) {
-                str_free(&str);
-                return E_LEX;
             }
+            cursor = skipped;
+        }
+    }
+}
 
-            break;
-        case SCANNER_STATE_STRING:
-
-            if(c == '\\') {
+/**
+ * Makes room for more tokens at the end of the token array.
+ *
+ * @param n Number of tokens to make room for.
+ * @return E_INT on allocation error, else E_OK.
+ */
+static int reserve_tokens(size_t n)
+{
+    if(token_count + n <= token_capacity) {
+        return E_OK;
+    }
+    size_t capacity = token_capacity ? token_capacity : TOKEN_ARRAY_LENGTH;
+    while(token_count + n > capacity) {
+        capacity *= 2;
+    }
+    token_t *tmp = realloc(tokens, capacity * sizeof(token_t));
+    if(!tmp) {
+        return E_INT;
+    }
+    tokens = tmp;
+    token_capacity = capacity;
+    return E_OK;
+}
 
-                state = SCANNER_STATE_ESCAPE_CHAR_SEQ;
+/**
+ * Lexer thread, fills batches until the last token or until the parser stops it.
+ */
+static void *lexer_thread(void *arg)
+{
+    (void) arg;
+    size_t head = 0;
+    bool last = false;
+
+    while(!last) {
+        // backpressure, wait until the parser frees a batch
+        pthread_mutex_lock(&ring.lock);
+        while(head - ring.tail == TOKEN_RING_LENGTH && !ring.stop) {
+            pthread_cond_wait(&ring.not_full, &ring.lock);
+        }
+        bool stop = ring.stop;
+        pthread_mutex_unlock(&ring.lock);
+        if(stop) {
+            return NULL;
+        }
 
-            } else if(c == '"') {
-                state = SCANNER_STATE_START;
-                t->token_type = T_STRING;
-                t->string = str;
+        token_batch_t *batch = &ring.batches[head & (TOKEN_RING_LENGTH - 1)];
+        batch->count = 0;
+        batch->result = E_OK;
+        while(batch->count < TOKEN_BATCH_LENGTH && !last) {
+            token_t *t = &batch->tokens[batch->count++];
+            batch->result = _get_next_token(t);
+            last = batch->result != E_OK || t->token_type == T_EOF;
+        }
+        batch->last = last;
 
-                return E_OK;
+        pthread_mutex_lock(&ring.lock);
+        ring.head = ++head;
+        pthread_cond_signal(&ring.not_empty);
+        pthread_mutex_unlock(&ring.lock);
+    }
+    return NULL;
+}
 
-            } else if(c == EOF) {
+/**
+ * Appends all batches published by the lexer thread to the token array, waits for one if there are
+ * none. Taking them at once wakes the lexer thread once per full ring instead of once per batch.
+ *
+ * @return E_INT if the token array couldn't grow, otherwise E_OK.
+ */
+static int take_batches(void)
+{
+    // only the parser moves tail
+    size_t tail = ring.tail;
+    pthread_mutex_lock(&ring.lock);
+    while(ring.head == tail) {
+        pthread_cond_wait(&ring.not_empty, &ring.lock);
+    }
+    size_t head = ring.head;
+    pthread_mutex_unlock(&ring.lock);
 
-                str_free(&str);
-                return E_LEX;
+    for(; tail != head; tail++) {
+        token_batch_t *batch = &ring.batches[tail & (TOKEN_RING_LENGTH - 1)];
+        if(reserve_tokens(batch->count)) {
+            return E_INT;
+        }
+        memcpy(tokens + token_count, batch->tokens, batch->count * sizeof(token_t));
+        token_count += batch->count;
+        lex_done = batch->last;
+        lex_result = batch->result;
+    }
 
-            } else {
-                if(c == '\n') {
-                    row++;
-                    column = 0;
-                }
+    pthread_mutex_lock(&ring.lock);
+    ring.tail = tail;
+    pthread_cond_signal(&ring.not_full);
+    pthread_mutex_unlock(&ring.lock);
+    return E_OK;
+}
 
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
+/**
+ * Lexes tokens until index ix is in the token array or the input is exhausted.
+ *
+ * @param ix Index of the token which is needed.
+ * @return E_INT if the token array couldn't grow, otherwise E_OK.
+ */
+static int lex_until(size_t ix)
+{
+    while(ix >= token_count && !lex_done) {
+        if(ring.batches) {
+            if(take_batches()) {
+                return E_INT;
             }
-            break;
-
-        case SCANNER_STATE_ESCAPE_CHAR_SEQ:
-
-            if(c == '\\') {
-
-                state = SCANNER_STATE_STRING;
-
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(c == 'n') {
-                state = SCANNER_STATE_STRING;
-
-                if(str_append_char(&str, '\n')) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(c == 't') {
-                state = SCANNER_STATE_STRING;
-
-                if(str_append_char(&str, '\t')) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(c == '"') {
-                state = SCANNER_STATE_STRING;
+            continue;
+        }
 
-                if(str_append_char(&str, '"')) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else if(isdigit(c)) {
-                state = SCANNER_STATE_ESCAPE_SEQ_1;
+        if(reserve_tokens(1)) {
+            return E_INT;
+        }
+        token_t *t = &tokens[token_count++];
+        lex_result = _get_next_token(t);
+        lex_done = lex_result != E_OK || t->token_type == T_EOF;
+    }
+    return E_OK;
+}
 
-                esc_mem[0] = c;
+int scanner_pipeline(void)
+{
+    if(ring.batches || lex_done) {
+        return E_OK;
+    }
 
-            } else {
-                str_free(&str);
-                return E_LEX;
-            }
-            break;
-        case SCANNER_STATE_ESCAPE_SEQ_1:
-            if(isdigit(c)) {
-                state = SCANNER_STATE_ESCAPE_SEQ_2;
+    ring.batches = malloc(TOKEN_RING_LENGTH * sizeof(token_batch_t));
+    if(!ring.batches) {
+        return E_INT;
+    }
+    ring.head = ring.tail = 0;
+    ring.stop = false;
+    if(pthread_create(&ring.thread, NULL, lexer_thread, NULL)) {
+        free(ring.batches);
+        ring.batches = NULL;
+        return E_INT;
+    }
+    return E_OK;
+}
 
-                esc_mem[1] = c;
-            } else {
-                str_free(&str);
-                return E_LEX;
-            }
-            break;
+void scanner_lex_ahead(void)
+{
+#ifdef SCANNER_PIPELINE
+    // a second thread only pays off on large sources and with a core to run on
+    if(source.length >= SCANNER_PIPELINE_MIN_LENGTH && sysconf(_SC_NPROCESSORS_ONLN) > 1 &&
+       scanner_pipeline() == E_OK) {
+        return;
+    }
+#endif
+    // lexical errors are returned again when the parser reaches them
+    scanner_tokenize();
+}
 
-        case SCANNER_STATE_ESCAPE_SEQ_2:
-            if(isdigit(c)) {
-                esc_mem[2] = c;
-
-                short unsigned int val = process_escape(esc_mem);
-                if(val) {
-                    if(str_append_char(&str, val)) {
-                        str_free(&str);
-                        return E_INT;
-                    }
-                } else {
-                    str_free(&str);
-                    return E_LEX;
-                }
-                state = SCANNER_STATE_STRING;
-            }
-            break;
-        case SCANNER_STATE_KEYWORD_IDENTIFIER:
-            if(c == '_' || isdigit(c) || isalpha(c)) {
-                if(str_append_char(&str, c)) {
-                    str_free(&str);
-                    return E_INT;
-                }
-            } else {
+int scanner_tokenize(void)
+{
+    if(lex_until(SIZE_MAX)) {
+        return E_INT;
+    }
+    return lex_result;
+}
 
-                state = SCANNER_STATE_START;
+int peek_token(size_t n, token_t *t)
+{
+    size_t ix = token_ix + n;
+    if(lex_until(ix)) {
+        return E_INT;
+    }
 
-                ungetc(c, fptr);
-                column--;
-                identify_keyword(&str, t);
-                return E_OK;
-            }
-        }
+    // the last token is T_EOF or a lexical error, it repeats forever
+    if(ix >= token_count - 1) {
+        *t = tokens[token_count - 1];
+        return lex_result;
     }
+    *t = tokens[ix];
+    return E_OK;
 }
 
 int get_next_token(token_t *t)
 {
-    if(last_token_ix) {
-        *t = last_tokens[--last_token_ix];
-        return E_OK;
-    }
-    int ret = _get_next_token(t);
-    for(int i = TOKEN_BUF_LENGTH - 1; i > 0; i--) {
-        last_tokens[i] = last_tokens[i - 1];
-    }
-    last_tokens[0] = *t;
+    int ret = peek_token(0, t);
+    token_ix++;
     return ret;
 }
 
 int unget_token()
 {
-    // can't unget any more tokens, buffer is full
-    if(last_token_ix >= TOKEN_BUF_LENGTH) {
+    // can't unget tokens that haven't been read
+    if(!token_ix) {
         return E_LEX;
     }
-    last_token_ix++;
+    token_ix--;
     return E_OK;
 }
+
+source_position_t token_position(const token_t *t)
+{
+    return source_position(&source, t->offset);
+}
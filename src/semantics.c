@@ -114,7 +114,8 @@ static void error_header()
 {
     token_t token;
     get_next_token(&token);
-    fprintf(stderr, "parser: error%d:%d: ", token.row, token.column);
+    source_position_t position = token_position(&token);
+    fprintf(stderr, "parser: error%zu:%zu: ", position.row, position.column);
 }
 
 #define PRINT_ERROR(message)                                                                       \
@@ -178,6 +179,7 @@ static const char *unop_type_to_readable(ast_node_unop_type_t type)
 }
 
 static ast_func_def_t *current_def;
+static atom_t atom_write;
 
 static int check_expression(ast_node_t **node, type_t *type);
 
@@ -302,12 +304,12 @@ int check_variable(ast_node_t *node, bool read, bool write)
     }
 
     if(node->symbol.is_declaration) {
-        char *name = node->symbol.name.ptr;
+        atom_t name = node->symbol.name;
 
-        PRINT(3, "checking variable: %s\n", name);
+        PRINT(3, "checking variable: %s\n", name->str);
         ast_node_t *sym = symtable_find(name);
         if(!sym) {
-            PRINT(3, "SEM Error: variable %s not defined\n", name);
+            PRINT(3, "SEM Error: variable %s not defined\n", name->str);
             return E_UNDEF;
         }
 
@@ -320,9 +322,8 @@ int check_variable(ast_node_t *node, bool read, bool write)
             return E_INT;
         }
 
-        PRINT(3, "Mapped to: %s , %s\n", declaration->name.ptr,
+        PRINT(3, "Mapped to: %s , %s\n", declaration->name->str,
               type_to_readable(declaration->type));
-        str_free(&node->symbol.name);
         node->symbol.declaration = declaration;
         node->symbol.is_declaration = false;
 
@@ -342,7 +343,7 @@ int check_variable(ast_node_t *node, bool read, bool write)
 
     } else {
         PRINT(3, "[SEM]                  !!!!! Duplicate check: Identifier: %s\n",
-              node->symbol.declaration->name.ptr);
+              node->symbol.declaration->name->str);
     }
     return E_OK;
 }
@@ -440,8 +441,8 @@ ast_node_t *get_func_call_returns(ast_node_t *node)
 
 int check_func_call(ast_node_t *node, bool main_body)
 {
-    char *name = node->func_call.name.ptr;
-    PRINT(3, "Check func call: %s\n", name);
+    atom_t name = node->func_call.name;
+    PRINT(3, "Check func call: %s\n", name->str);
 
     ast_node_t *sym = symtable_find_in_global(name);
     if(!sym) {
@@ -484,7 +485,7 @@ int check_func_call(ast_node_t *node, bool main_body)
     }
 
     // special case: variadic arguments
-    bool ignore_types = (strcmp(name, "write") == 0);
+    bool ignore_types = (name == atom_write);
     if(!ignore_types) {
         // check arguments and type compatibility
         ast_node_t *args = def ? def->arguments : decl->argument_types;
@@ -505,7 +506,7 @@ int check_func_call(ast_node_t *node, bool main_body)
             }
 
             type_t dest;
-            // printf("  Get type of %s\n", input->symbol.name.ptr);
+            // printf("  Get type of %s\n", input->symbol.name->str);
             r = sem_get_type(args, &dest);
             if(r != E_OK) {
                 return r;
@@ -561,9 +562,9 @@ static int compare_types(ast_node_list_t left, ast_node_list_t right)
     return E_OK;
 }
 
-static int check_declared_variable(char *identifier, ast_node_t *node)
+static int check_declared_variable(atom_t identifier, ast_node_t *node)
 {
-    PRINT(3, "Check arg name: %s\n", identifier);
+    PRINT(3, "Check arg name: %s\n", identifier->str);
     ast_node_t *sym = symtable_find_in_current(identifier);
     if(sym) {
         PRINT(3, "SEM error: variable redeclaration\n");
@@ -582,13 +583,22 @@ static int check_declared_variable(char *identifier, ast_node_t *node)
 
     static const char separator = '%';
 
-    char temp[80];
-    sprintf(temp, "%c%d", separator, symtable_scope_level());
-
-    for(char *c = temp; *c != '\0'; ++c) {
-        if(str_append_char(&node->declaration.symbol.name, *c) != 0) {
-            return E_INT;
-        }
+    // name%scope, short names stay in the inline buffer
+    atom_t name = node->declaration.symbol.name;
+    str_view_t name_view = { name->str, name->length };
+    string_t mangled;
+    if(str_create_view(name_view, &mangled)) {
+        return E_INT;
+    }
+    if(str_append_char(&mangled, separator) ||
+       str_append_int(&mangled, symtable_scope_level())) {
+        str_free(&mangled);
+        return E_INT;
+    }
+    node->declaration.symbol.name = atom_intern(mangled.ptr, mangled.length);
+    str_free(&mangled);
+    if(!node->declaration.symbol.name) {
+        return E_INT;
     }
 
     node->declaration.symbol.last_assignment = &node->declaration.symbol;
@@ -602,7 +612,7 @@ static int check_argument_names(ast_node_t *node)
     PRINT(3, "Checking definition arguments\n");
     ast_node_t *it = node->func_decl.argument_types;
     while(it) {
-        char *name = it->symbol.name.ptr;
+        atom_t name = it->symbol.name;
         int r = check_declared_variable(name, it);
         if(r != E_OK) {
             return r;
@@ -612,9 +622,9 @@ static int check_argument_names(ast_node_t *node)
     return E_OK;
 }
 
-int check_function(ast_node_t *node, char *name)
+int check_function(ast_node_t *node, atom_t name)
 {
-    PRINT(3, "Checking funcion: %s\n", name);
+    PRINT(3, "Checking funcion: %s\n", name->str);
     ast_node_t *sym = symtable_find_in_global(name);
 
     if(sym) {
@@ -754,7 +764,7 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
 
                 ast_node_t *iterator = node->for_loop.iterator;
 
-                int r = check_declared_variable(iterator->symbol.name.ptr, iterator);
+                int r = check_declared_variable(iterator->symbol.name, iterator);
                 if(r != E_OK) {
                     return r;
                 }
@@ -802,138 +812,52 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
                     for_type = TYPE_NUMBER;
                 }
 
-                ast_node_t *copy_decl = calloc(1, sizeof(ast_node_t));
-                if(!copy_decl) {
-                    return E_INT;
-                }
-                ast_node_t *iterator_decl = calloc(1, sizeof(ast_node_t));
-                if(!iterator_decl) {
-                    free(copy_decl);
-                    return E_INT;
-                }
-                ast_node_t *condition_decl = calloc(1, sizeof(ast_node_t));
-                if(!condition_decl) {
-                    free(copy_decl);
-                    free(iterator_decl);
-                    return E_INT;
-                }
-                ast_node_t *step_decl = calloc(1, sizeof(ast_node_t));
-                if(!step_decl) {
-                    free(copy_decl);
-                    free(iterator_decl);
-                    free(condition_decl);
+                // nodes are owned by the AST arena, no need to free them on error
+                ast_node_t *copy_decl = ast_alloc_node(AST_NODE_DECLARATION);
+                ast_node_t *iterator_decl = ast_alloc_node(AST_NODE_DECLARATION);
+                ast_node_t *condition_decl = ast_alloc_node(AST_NODE_DECLARATION);
+                ast_node_t *step_decl = ast_alloc_node(AST_NODE_DECLARATION);
+                if(!copy_decl || !iterator_decl || !condition_decl || !step_decl) {
                     return E_INT;
                 }
 
                 iterator->symbol.type = TYPE_INTEGER; // todo
 
-                copy_decl->node_type = AST_NODE_DECLARATION;
                 copy_decl->declaration.symbol = iterator->symbol;
                 copy_decl->declaration.symbol.type = for_type;
                 copy_decl->declaration.assignment = NULL;
 
-                iterator_decl->node_type = AST_NODE_DECLARATION;
                 iterator_decl->declaration.symbol = iterator->symbol;
                 iterator_decl->declaration.symbol.type = for_type;
-                iterator_decl->declaration.symbol.name.ptr = NULL;
-                iterator_decl->declaration.symbol.name.alloc_length = 0;
-                iterator_decl->declaration.symbol.name.length = 0;
+                iterator_decl->declaration.symbol.name = atom_concat(iterator->symbol.name, "&");
                 iterator_decl->declaration.assignment = setup;
 
-                condition_decl->node_type = AST_NODE_DECLARATION;
                 condition_decl->declaration.symbol = iterator->symbol;
                 condition_decl->declaration.symbol.type = for_type;
-                condition_decl->declaration.symbol.name.ptr = NULL;
-                condition_decl->declaration.symbol.name.alloc_length = 0;
-                condition_decl->declaration.symbol.name.length = 0;
+                condition_decl->declaration.symbol.name =
+                    atom_concat(iterator->symbol.name, "&cond");
                 condition_decl->declaration.assignment = condition;
 
-                step_decl->node_type = AST_NODE_DECLARATION;
                 step_decl->declaration.symbol = iterator->symbol;
                 step_decl->declaration.symbol.type = for_type;
-                step_decl->declaration.symbol.name.ptr = NULL;
-                step_decl->declaration.symbol.name.alloc_length = 0;
-                step_decl->declaration.symbol.name.length = 0;
-
-                if(str_create(iterator->symbol.name.ptr, &iterator_decl->declaration.symbol.name) !=
-                   E_OK) {
-                    free(copy_decl);
-                    free(iterator_decl);
-                    free(condition_decl);
-                    free(step_decl);
-                    return E_INT;
-                }
-                if(str_append_char(&iterator_decl->declaration.symbol.name, '&') != E_OK) {
-                    str_free(&iterator_decl->declaration.symbol.name);
-                    free(copy_decl);
-                    free(iterator_decl);
-                    free(condition_decl);
-                    free(step_decl);
-                    return E_INT;
-                }
+                step_decl->declaration.symbol.name = atom_concat(iterator->symbol.name, "&step");
 
-                if(str_create(iterator->symbol.name.ptr,
-                              &condition_decl->declaration.symbol.name) != E_OK) {
-                    str_free(&iterator_decl->declaration.symbol.name);
-                    free(copy_decl);
-                    free(iterator_decl);
-                    free(condition_decl);
-                    free(step_decl);
+                if(!iterator_decl->declaration.symbol.name ||
+                   !condition_decl->declaration.symbol.name ||
+                   !step_decl->declaration.symbol.name) {
                     return E_INT;
                 }
-                for(char *c = "&cond"; *c != '\0'; ++c) {
-                    if(str_append_char(&condition_decl->declaration.symbol.name, *c) != E_OK) {
-                        str_free(&iterator_decl->declaration.symbol.name);
-                        str_free(&condition_decl->declaration.symbol.name);
-                        free(copy_decl);
-                        free(iterator_decl);
-                        free(condition_decl);
-                        free(step_decl);
-                        return E_INT;
-                    }
-                }
-
-                if(str_create(iterator->symbol.name.ptr, &step_decl->declaration.symbol.name) !=
-                   E_OK) {
-                    str_free(&iterator_decl->declaration.symbol.name);
-                    str_free(&step_decl->declaration.symbol.name);
-                    free(copy_decl);
-                    free(iterator_decl);
-                    free(condition_decl);
-                    free(step_decl);
-                    return E_INT;
-                }
-                for(char *c = "&step"; *c != '\0'; ++c) {
-                    if(str_append_char(&step_decl->declaration.symbol.name, *c) != E_OK) {
-                        str_free(&iterator_decl->declaration.symbol.name);
-                        str_free(&condition_decl->declaration.symbol.name);
-                        str_free(&step_decl->declaration.symbol.name);
-                        free(copy_decl);
-                        free(iterator_decl);
-                        free(condition_decl);
-                        free(step_decl);
-                        return E_INT;
-                    }
-                }
 
                 if(!step) {
-                    ast_node_t *default_step = calloc(1, sizeof(ast_node_t));
+                    ast_node_t *default_step = ast_alloc_node(
+                        for_type == TYPE_INTEGER ? AST_NODE_INTEGER : AST_NODE_NUMBER);
                     if(!default_step) {
-                        str_free(&iterator_decl->declaration.symbol.name);
-                        str_free(&condition_decl->declaration.symbol.name);
-                        str_free(&step_decl->declaration.symbol.name);
-                        free(copy_decl);
-                        free(iterator_decl);
-                        free(condition_decl);
-                        free(step_decl);
                         return E_INT;
                     }
 
                     if(for_type == TYPE_INTEGER) {
-                        default_step->node_type = AST_NODE_INTEGER;
                         default_step->integer = 1;
                     } else {
-                        default_step->node_type = AST_NODE_NUMBER;
                         default_step->number = 1.0;
                     }
                     step_decl->declaration.assignment = default_step;
@@ -1042,9 +966,9 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
         case AST_NODE_DECLARATION:
             if(expected.is_nterm && expected.nterm == NT_DECLARATION) {
 
-                char *name = node->declaration.symbol.name.ptr;
+                atom_t name = node->declaration.symbol.name;
 
-                PRINT(3, "check local declaration: %s\n", name);
+                PRINT(3, "check local declaration: %s\n", name->str);
 
                 int r = E_OK;
                 if(node->declaration.assignment) {
@@ -1069,7 +993,7 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
             break;
         case AST_NODE_FUNC_DECL:
             if(expected.is_nterm && expected.nterm == NT_FUNC_DECL) {
-                char *name = node->func_decl.name.ptr;
+                atom_t name = node->func_decl.name;
                 int r = check_function(node, name);
                 if(r != E_OK) {
                     return r;
@@ -1079,7 +1003,7 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
         case AST_NODE_FUNC_DEF:
             if(expected.is_nterm && expected.nterm == NT_FUNC_TYPE_LIST) {
 
-                char *name = node->func_def.name.ptr;
+                atom_t name = node->func_def.name;
 
                 int r = check_function(node, name);
                 if(r != E_OK) {
@@ -1105,8 +1029,7 @@ int sem_check(ast_node_t *node, int i, nut_type_t expected)
             break;
         case AST_NODE_RETURN:
             if(expected.is_nterm && expected.nterm == NT_RET_EXPRESSION_LIST) {
-                // char *name = node->func_call.name.ptr;
-                PRINT(3, "%s: checking return in: %s\n", __func__, current_def->name.ptr);
+                PRINT(3, "%s: checking return in: %s\n", __func__, current_def->name->str);
 
                 node->return_values.def = current_def;
 
@@ -1400,8 +1323,7 @@ int check_binop_node(ast_node_t **node, type_t *type)
 }
 
 static ast_node_t builtin_write = { .node_type = AST_NODE_FUNC_DEF,
-                                    .func_def = { .name.ptr = "write",
-                                                  .arguments = NULL,
+                                    .func_def = { .arguments = NULL,
                                                   .return_types = NULL,
                                                   .body = NULL,
                                                   .decl = NULL },
@@ -1409,8 +1331,7 @@ static ast_node_t builtin_write = { .node_type = AST_NODE_FUNC_DEF,
                                     .visited_children = 0 };
 
 static ast_node_t builtin_reads = { .node_type = AST_NODE_FUNC_DEF,
-                                    .func_def = { .name.ptr = "reads",
-                                                  .arguments = NULL,
+                                    .func_def = { .arguments = NULL,
                                                   .return_types =
                                                       &(ast_node_t){ .node_type = AST_NODE_TYPE,
                                                                      .type = TYPE_STRING,
@@ -1422,8 +1343,7 @@ static ast_node_t builtin_reads = { .node_type = AST_NODE_FUNC_DEF,
                                     .visited_children = 0 };
 
 static ast_node_t builtin_readi = { .node_type = AST_NODE_FUNC_DEF,
-                                    .func_def = { .name.ptr = "readi",
-                                                  .arguments = NULL,
+                                    .func_def = { .arguments = NULL,
                                                   .return_types =
                                                       &(ast_node_t){ .node_type = AST_NODE_TYPE,
                                                                      .type = TYPE_INTEGER,
@@ -1435,8 +1355,7 @@ static ast_node_t builtin_readi = { .node_type = AST_NODE_FUNC_DEF,
                                     .visited_children = 0 };
 
 static ast_node_t builtin_readn = { .node_type = AST_NODE_FUNC_DEF,
-                                    .func_def = { .name.ptr = "readn",
-                                                  .arguments = NULL,
+                                    .func_def = { .arguments = NULL,
                                                   .return_types =
                                                       &(ast_node_t){ .node_type = AST_NODE_TYPE,
                                                                      .type = TYPE_NUMBER,
@@ -1449,8 +1368,7 @@ static ast_node_t builtin_readn = { .node_type = AST_NODE_FUNC_DEF,
 
 static ast_node_t builtin_tointeger = {
     .node_type = AST_NODE_FUNC_DEF,
-    .func_def = { .name.ptr = "tointeger",
-                  .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
+    .func_def = { .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
                                               .symbol.type = TYPE_NUMBER,
                                               .symbol.is_declaration = true,
                                               .next = NULL,
@@ -1467,8 +1385,7 @@ static ast_node_t builtin_tointeger = {
 
 static ast_node_t builtin_substr = {
     .node_type = AST_NODE_FUNC_DEF,
-    .func_def = { .name.ptr = "substr",
-                  .arguments =
+    .func_def = { .arguments =
                       &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
                                      .symbol.type = TYPE_STRING,
                                      .symbol.is_declaration = true,
@@ -1497,8 +1414,7 @@ static ast_node_t builtin_substr = {
 
 static ast_node_t builtin_ord = {
     .node_type = AST_NODE_FUNC_DEF,
-    .func_def = { .name.ptr = "ord",
-                  .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
+    .func_def = { .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
                                               .symbol.type = TYPE_STRING,
                                               .symbol.is_declaration = true,
                                               .visited_children = 0,
@@ -1519,8 +1435,7 @@ static ast_node_t builtin_ord = {
 
 static ast_node_t builtin_chr = {
     .node_type = AST_NODE_FUNC_DEF,
-    .func_def = { .name.ptr = "chr",
-                  .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
+    .func_def = { .arguments = &(ast_node_t){ .node_type = AST_NODE_SYMBOL,
                                               .symbol.type = TYPE_INTEGER,
                                               .symbol.is_declaration = true,
                                               .next = NULL,
@@ -1542,14 +1457,24 @@ int semantics_init()
         return r;
     }
 
-    symtable_put_in_global("write", &builtin_write);
-    symtable_put_in_global("reads", &builtin_reads);
-    symtable_put_in_global("readi", &builtin_readi);
-    symtable_put_in_global("readn", &builtin_readn);
-    symtable_put_in_global("tointeger", &builtin_tointeger);
-    symtable_put_in_global("substr", &builtin_substr);
-    symtable_put_in_global("ord", &builtin_ord);
-    symtable_put_in_global("chr", &builtin_chr);
+    struct {
+        ast_node_t *node;
+        const char *name;
+    } builtins[] = {
+        { &builtin_write, "write" },         { &builtin_reads, "reads" },
+        { &builtin_readi, "readi" },         { &builtin_readn, "readn" },
+        { &builtin_tointeger, "tointeger" }, { &builtin_substr, "substr" },
+        { &builtin_ord, "ord" },             { &builtin_chr, "chr" },
+    };
+    for(size_t i = 0; i < sizeof(builtins) / sizeof(*builtins); i++) {
+        atom_t name = atom_intern_cstr(builtins[i].name);
+        if(!name) {
+            return E_INT;
+        }
+        builtins[i].node->func_def.name = name;
+        symtable_put_in_global(name, builtins[i].node);
+    }
+    atom_write = builtin_write.func_def.name;
 
     current_def = NULL;
 
@@ -1563,7 +1488,7 @@ void semantics_free()
 
 bool sem_is_builtin_used(char *name)
 {
-    ast_node_t *sym = symtable_find_in_global(name);
+    ast_node_t *sym = symtable_find_in_global(atom_intern_cstr(name));
     if(sym && sym->node_type == AST_NODE_FUNC_DEF) {
         return sym->func_def.used;
     }
@@ -18,113 +18,185 @@
 #include <stdio.h>
 
 #include "error.h"
-#include "deque.h"
+#include "pool.h"
 #include "string.h"
-#include "stack.h"
+#include "typed_hashtable.h"
+#include "typed_stack.h"
 
-#define DEFAULT_SIZE (101)
+#define DEFAULT_SIZE (256)
 
-static deque_t scopes;
+/**
+ * @brief Declaration of identifier in one scope
+ *
+ * Bindings of one identifier form a chain from the innermost scope outward,
+ * the map always points to the innermost one.
+ */
+typedef struct binding {
+    atom_t identifier;        ///< declared identifier
+    ast_node_t *data;         ///< symbol data
+    int level;                ///< scope level of declaration, 0 is global
+    struct binding *shadowed; ///< binding from an outer scope, NULL if none
+} binding_t;
+
+DEFINE_HASHTABLE(binding_map, atom_t, struct binding *, atom_hash, atom_equal)
+DEFINE_STACK(binding_stack, struct binding *)
+
+/// identifier -> innermost binding (NULL once all bindings went out of scope)
+static binding_map_t bindings;
 
-static hashtable_t *global_scope;
+/// bindings in declaration order, NULL marks the start of a scope
+static binding_stack_t undo_log;
 
-static uint64_t hash(const char *key)
+/// storage of all bindings
+static pool_t binding_pool = { .object_size = sizeof(binding_t) };
+
+static int level;
+
+static binding_t *alloc_binding(atom_t identifier, ast_node_t *data, int binding_level)
 {
-    uint64_t h = 0;
-    for(const char *c = key; *c != '\0'; ++c) {
-        h = ((h << 5) ^ (h >> 27)) ^ *c;
+    binding_t *binding = pool_alloc(&binding_pool);
+    if(!binding) {
+        return NULL;
     }
-    return h;
+    binding->identifier = identifier;
+    binding->data = data;
+    binding->level = binding_level;
+    binding->shadowed = NULL;
+    return binding;
 }
 
-static void free_scope(hashtable_t *scope)
+static binding_t *find_binding(atom_t identifier)
 {
-    hashtable_free(scope);
-    free(scope);
+    binding_t **binding = binding_map_find(&bindings, identifier);
+    return binding ? *binding : NULL;
 }
 
 int symtable_init()
 {
-    deque_create(&scopes);
-    if(symtable_push_scope() != E_OK) {
+    level = 0;
+    if(binding_map_create(&bindings, DEFAULT_SIZE) != E_OK) {
+        return E_INT;
+    }
+    binding_stack_create(&undo_log);
+    if(binding_stack_reserve(&undo_log, DEFAULT_SIZE) != E_OK) {
+        binding_map_free(&bindings);
         return E_INT;
     }
-    global_scope = deque_front(&scopes);
     return E_OK;
 }
 
 void symtable_free()
 {
-    while(!deque_empty(&scopes)) {
-        free_scope(deque_pop_front(&scopes));
-    }
-    deque_free(&scopes);
+    binding_stack_free(&undo_log);
+    binding_map_free(&bindings);
+    pool_free(&binding_pool);
+    level = 0;
 }
 
 int symtable_push_scope()
 {
-    hashtable_t *scope = malloc(sizeof(hashtable_t));
-    if(hashtable_create_bst(scope, DEFAULT_SIZE, hash) != E_OK) {
-        free(scope);
+    if(binding_stack_push(&undo_log, NULL) != E_OK) {
         return E_INT;
     }
-    return deque_push_front(&scopes, scope);
+    level++;
+    return E_OK;
 }
 
 int symtable_pop_scope()
 {
-    if(deque_empty(&scopes) || deque_front(&scopes) == global_scope) {
+    if(level == 0) {
         return E_INT;
     }
-    free_scope(deque_pop_front(&scopes));
+    binding_t *binding;
+    while((binding = binding_stack_pop(&undo_log))) {
+        // replacing an existing key doesn't allocate
+        binding_map_insert(&bindings, binding->identifier, binding->shadowed);
+        pool_release(&binding_pool, binding);
+    }
+    level--;
     return E_OK;
 }
 
-static ast_node_t *find_in_table(hashtable_t *scope, const char *identifier)
+ast_node_t *symtable_find(atom_t identifier)
 {
-    void *symbol;
-    if(hashtable_find(scope, identifier, &symbol) == E_OK) {
-        return (ast_node_t *) symbol;
-    }
-    return NULL;
+    binding_t *binding = find_binding(identifier);
+    return binding ? binding->data : NULL;
 }
 
-ast_node_t *symtable_find(const char *identifier)
+ast_node_t *symtable_find_in_global(atom_t identifier)
 {
-    deque_element_t *it = deque_front_element(&scopes);
-    while(it) {
-        ast_node_t *symbol = find_in_table(it->data, identifier);
-        if(symbol) {
-            return symbol;
-        }
-        it = it->next;
-    }
-    return NULL;
+    binding_t *binding = find_binding(identifier);
+    while(binding && binding->level > 0) {
+        binding = binding->shadowed;
+    }
+    return binding ? binding->data : NULL;
 }
 
-ast_node_t *symtable_find_in_global(const char *identifier)
+ast_node_t *symtable_find_in_current(atom_t identifier)
 {
-    return find_in_table(global_scope, identifier);
+    binding_t *binding = find_binding(identifier);
+    return binding && binding->level == level ? binding->data : NULL;
 }
 
-ast_node_t *symtable_find_in_current(const char *identifier)
+int symtable_put_symbol(atom_t identifier, ast_node_t *data)
 {
-    hashtable_t *scope = deque_front(&scopes);
-    return find_in_table(scope, identifier);
+    binding_t *head = find_binding(identifier);
+    if(head && head->level == level) {
+        head->data = data;
+        return E_OK;
+    }
+
+    binding_t *binding = alloc_binding(identifier, data, level);
+    if(!binding) {
+        return E_INT;
+    }
+    binding->shadowed = head;
+    if(binding_stack_push(&undo_log, binding) != E_OK) {
+        pool_release(&binding_pool, binding);
+        return E_INT;
+    }
+    if(binding_map_insert(&bindings, identifier, binding) != E_OK) {
+        binding_stack_pop(&undo_log);
+        pool_release(&binding_pool, binding);
+        return E_INT;
+    }
+    return E_OK;
 }
 
-int symtable_put_symbol(const char *identifier, ast_node_t *data)
+int symtable_put_in_global(atom_t identifier, ast_node_t *data)
 {
-    hashtable_t *scope = deque_front(&scopes);
-    return hashtable_insert(scope, identifier, data);
+    if(level == 0) {
+        return symtable_put_symbol(identifier, data);
+    }
+
+    // global bindings made from nested scopes go below the nested ones and aren't logged
+    binding_t *outermost = find_binding(identifier);
+    while(outermost && outermost->shadowed) {
+        outermost = outermost->shadowed;
+    }
+    if(outermost && outermost->level == 0) {
+        outermost->data = data;
+        return E_OK;
+    }
+    binding_t *binding = alloc_binding(identifier, data, 0);
+    if(!binding) {
+        return E_INT;
+    }
+    if(outermost) {
+        outermost->shadowed = binding;
+    } else if(binding_map_insert(&bindings, identifier, binding) != E_OK) {
+        pool_release(&binding_pool, binding);
+        return E_INT;
+    }
+    return E_OK;
 }
 
-int symtable_put_in_global(const char *identifier, ast_node_t *data)
+int symtable_scope_level()
 {
-    return hashtable_insert(global_scope, identifier, data);
+    return level;
 }
 
-int symtable_scope_level()
+pool_stats_t symtable_pool_stats()
 {
-    return scopes.size - 1;
+    return binding_pool.stats;
 }
@@ -0,0 +1,80 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file arena.c
+ *
+ * @brief Bump allocator, everything allocated from an arena is released at once
+ */
+#include "arena.h"
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// size of the first chunk
+#define ARENA_MIN_CHUNK_SIZE (64 * 1024)
+/// chunks stop growing at this size
+#define ARENA_MAX_CHUNK_SIZE (4 * 1024 * 1024)
+
+struct arena_chunk {
+    arena_chunk_t *next; ///< previously filled chunk
+    max_align_t data[];  ///< chunk memory
+};
+
+static int arena_grow(arena_t *arena, size_t size)
+{
+    if(arena->chunk_size < ARENA_MIN_CHUNK_SIZE) {
+        arena->chunk_size = ARENA_MIN_CHUNK_SIZE;
+    }
+    size_t chunk_size = arena->chunk_size;
+    while(chunk_size < size) {
+        chunk_size *= 2;
+    }
+
+    arena_chunk_t *chunk = malloc(sizeof(arena_chunk_t) + chunk_size);
+    if(!chunk) {
+        return 1;
+    }
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->cursor = (char *) chunk->data;
+    arena->end = arena->cursor + chunk_size;
+    if(arena->chunk_size < ARENA_MAX_CHUNK_SIZE) {
+        arena->chunk_size *= 2;
+    }
+    return 0;
+}
+
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    size = (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+    bool fits = arena->chunks && (size_t)(arena->end - arena->cursor) >= size;
+    if(!fits && arena_grow(arena, size)) {
+        return NULL;
+    }
+    void *ptr = arena->cursor;
+    arena->cursor += size;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+void arena_free(arena_t *arena)
+{
+    while(arena->chunks) {
+        arena_chunk_t *next = arena->chunks->next;
+        free(arena->chunks);
+        arena->chunks = next;
+    }
+    arena->cursor = NULL;
+    arena->end = NULL;
+    arena->chunk_size = 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file atom.c
+ *
+ * @brief Identifier interning table
+ */
+#include "atom.h"
+#include "hash.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/// initial number of slots, has to be a power of two
+#define ATOM_TABLE_SIZE 256
+/// size of storage chunks atoms are allocated from
+#define ATOM_CHUNK_SIZE 16384
+
+/**
+ * @brief Storage chunk, atoms are never freed one by one
+ */
+typedef struct atom_chunk {
+    struct atom_chunk *next; ///< previously filled chunk
+    size_t used;             ///< bytes used in data
+    size_t size;             ///< bytes allocated for data
+    uint64_t data[];         ///< atom storage, uint64_t keeps atoms aligned
+} atom_chunk_t;
+
+static struct {
+    atom_t *slots;        ///< open addressing table, NULL marks an empty slot
+    size_t size;          ///< number of slots
+    size_t count;         ///< number of atoms
+    atom_chunk_t *chunks; ///< storage
+} table;
+
+static struct atom *alloc_atom(size_t length)
+{
+    size_t size = offsetof(struct atom, str) + length + 1;
+    size = (size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    atom_chunk_t *chunk = table.chunks;
+    if(!chunk || chunk->size - chunk->used < size) {
+        size_t chunk_size = size > ATOM_CHUNK_SIZE ? size : ATOM_CHUNK_SIZE;
+        chunk = malloc(sizeof(atom_chunk_t) + chunk_size);
+        if(!chunk) {
+            return NULL;
+        }
+        chunk->used = 0;
+        chunk->size = chunk_size;
+        chunk->next = table.chunks;
+        table.chunks = chunk;
+    }
+
+    struct atom *atom = (struct atom *) ((char *) chunk->data + chunk->used);
+    chunk->used += size;
+    return atom;
+}
+
+static int grow(void)
+{
+    size_t size = table.size ? table.size * 2 : ATOM_TABLE_SIZE;
+    atom_t *slots = calloc(size, sizeof(atom_t));
+    if(!slots) {
+        return 1;
+    }
+    for(size_t i = 0; i < table.size; i++) {
+        atom_t atom = table.slots[i];
+        if(atom) {
+            size_t index = atom->hash & (size - 1);
+            while(slots[index]) {
+                index = (index + 1) & (size - 1);
+            }
+            slots[index] = atom;
+        }
+    }
+    free(table.slots);
+    table.slots = slots;
+    table.size = size;
+    return 0;
+}
+
+/**
+ * @brief Finds slot of s, which is either its atom or the empty slot it belongs to
+ */
+static size_t lookup(const char *s, size_t length, uint64_t h)
+{
+    size_t index = h & (table.size - 1);
+    while(table.slots[index]) {
+        atom_t atom = table.slots[index];
+        if(atom->hash == h && atom->length == length && !memcmp(atom->str, s, length)) {
+            break;
+        }
+        index = (index + 1) & (table.size - 1);
+    }
+    return index;
+}
+
+atom_t atom_intern(const char *s, size_t length)
+{
+    // keep load factor under 1/2
+    if(2 * (table.count + 1) > table.size && grow()) {
+        return NULL;
+    }
+
+    uint64_t h = HASH_DEFAULT(s, length);
+    size_t index = lookup(s, length, h);
+    if(table.slots[index]) {
+        return table.slots[index];
+    }
+
+    struct atom *atom = alloc_atom(length);
+    if(!atom) {
+        return NULL;
+    }
+    atom->hash = h;
+    atom->length = length;
+    memcpy(atom->str, s, length);
+    atom->str[length] = '\0';
+
+    table.slots[index] = atom;
+    table.count++;
+    return atom;
+}
+
+atom_t atom_intern_cstr(const char *s)
+{
+    return atom_intern(s, strlen(s));
+}
+
+atom_t atom_find(const char *s, size_t length)
+{
+    if(!table.size) {
+        return NULL;
+    }
+    return table.slots[lookup(s, length, HASH_DEFAULT(s, length))];
+}
+
+atom_t atom_find_cstr(const char *s)
+{
+    return atom_find(s, strlen(s));
+}
+
+atom_t atom_concat(atom_t atom, const char *suffix)
+{
+    char buffer[256];
+    size_t suffix_length = strlen(suffix);
+    size_t length = atom->length + suffix_length;
+
+    char *s = length < sizeof(buffer) ? buffer : malloc(length);
+    if(!s) {
+        return NULL;
+    }
+    memcpy(s, atom->str, atom->length);
+    memcpy(s + atom->length, suffix, suffix_length);
+
+    atom_t result = atom_intern(s, length);
+    if(s != buffer) {
+        free(s);
+    }
+    return result;
+}
+
+void atom_table_free(void)
+{
+    while(table.chunks) {
+        atom_chunk_t *next = table.chunks->next;
+        free(table.chunks);
+        table.chunks = next;
+    }
+    free(table.slots);
+    table.slots = NULL;
+    table.size = 0;
+    table.count = 0;
+}
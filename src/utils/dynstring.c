@@ -14,62 +14,196 @@
  */
 #include "dynstring.h"
 
+#include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "error.h"
 
-int str_create_empty(string_t *str)
+/// longest decimal int64_t with sign
+#define STRING_INT_LENGTH 20
+/// longest "%a" double with sign, "-0x1.fffffffffffffp+1023", and null byte
+#define STRING_FLOAT_LENGTH 32
+
+/**
+ * @brief Tells whether the string owns a heap buffer
+ *
+ * Heap buffers are always larger than the inline one, so ownership follows from the capacity
+ * alone and struct copies of short or borrowed strings are never freed.
+ */
+static bool str_on_heap(const string_t *str)
 {
-    // allocate initial space for string
-    str->ptr = malloc(STRING_ALLOC_LENGTH);
-    if(str->ptr == NULL) {
-        return E_INT;
+    return str->alloc_length > STRING_SMALL_LENGTH;
+}
+
+/**
+ * @brief Points an empty string to a buffer of at least size bytes, inline if it fits.
+ *
+ * @return E_INT on allocation error, else E_OK
+ */
+static int str_init(string_t *str, size_t size)
+{
+    if(size <= STRING_SMALL_LENGTH) {
+        str->ptr = str->small;
+        str->alloc_length = STRING_SMALL_LENGTH;
+    } else {
+        str->ptr = malloc(size);
+        if(str->ptr == NULL) {
+            return E_INT;
+        }
+        str->alloc_length = size;
     }
-    str->ptr[0] = '\0';
     str->length = 0;
-    str->alloc_length = STRING_ALLOC_LENGTH;
+    str->ptr[0] = '\0';
     return E_OK;
 }
 
+int str_create_empty(string_t *str)
+{
+    return str_init(str, 1);
+}
+
 int str_create(const char *s, string_t *str)
 {
-    // allocate space for string
-    size_t length = strlen(s);
-    str->ptr = malloc(length + 1);
-    if(str->ptr == NULL) {
+    str_view_t view = { s, strlen(s) };
+    return str_create_view(view, str);
+}
+
+int str_create_view(str_view_t view, string_t *str)
+{
+    if(str_init(str, view.length + 1)) {
         return E_INT;
     }
-    str->length = length;
-    str->alloc_length = length + 1;
-    strcpy(str->ptr, s);
+    str->length = view.length;
+    memcpy(str->ptr, view.ptr, view.length);
+    str->ptr[view.length] = '\0';
     return E_OK;
 }
 
-int str_append_char(string_t *str, char ch)
+int str_reserve(string_t *str, size_t length)
 {
-    // new_char + null byte = 2
-    if(str->length + 2 > str->alloc_length) {
-
-        /* allocate buffer twice as large
-         * note: str->alloc_length can't be equal to 0 unless STRING_ALLOC_LENGTH is set to 0 or an
-         * overflow happened
-         */
-        str->alloc_length *= 2;
-        void *tmp = realloc(str->ptr, str->alloc_length);
+    size_t size = length + 1;
+    if(size <= str->alloc_length) {
+        return E_OK;
+    }
+
+    // grow geometrically, inline and borrowed buffers move to the heap
+    size_t alloc_length = str_on_heap(str) ? str->alloc_length : STRING_SMALL_LENGTH;
+    do {
+        alloc_length *= 2;
+    } while(size > alloc_length);
+
+    char *tmp;
+    if(str_on_heap(str)) {
+        tmp = realloc(str->ptr, alloc_length);
         if(tmp == NULL) {
             return E_INT;
         }
-        str->ptr = tmp;
+    } else {
+        tmp = malloc(alloc_length);
+        if(tmp == NULL) {
+            return E_INT;
+        }
+        memcpy(tmp, str->ptr, str->length);
+        tmp[str->length] = '\0';
+    }
+    str->ptr = tmp;
+    str->alloc_length = alloc_length;
+    return E_OK;
+}
+
+int str_append_char(string_t *str, char ch)
+{
+    if(str_reserve(str, str->length + 1)) {
+        return E_INT;
     }
     str->ptr[str->length++] = ch;
     str->ptr[str->length] = '\0';
     return E_OK;
 }
 
+int str_append_view(string_t *str, str_view_t view)
+{
+    if(str_reserve(str, str->length + view.length)) {
+        return E_INT;
+    }
+    memcpy(str->ptr + str->length, view.ptr, view.length);
+    str->length += view.length;
+    str->ptr[str->length] = '\0';
+    return E_OK;
+}
+
+int str_append_cstr(string_t *str, const char *s)
+{
+    str_view_t view = { s, strlen(s) };
+    return str_append_view(str, view);
+}
+
+int str_append_str(string_t *str, const string_t *other)
+{
+    str_view_t view = { other->ptr, other->length };
+    return str_append_view(str, view);
+}
+
+int str_append_int(string_t *str, int64_t value)
+{
+    // digits are produced from the lowest one
+    char buffer[STRING_INT_LENGTH];
+    char *p = buffer + sizeof(buffer);
+    uint64_t magnitude = value < 0 ? -(uint64_t) value : (uint64_t) value;
+    do {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while(magnitude);
+    if(value < 0) {
+        *--p = '-';
+    }
+
+    str_view_t view = { p, buffer + sizeof(buffer) - p };
+    return str_append_view(str, view);
+}
+
+int str_append_float(string_t *str, double value)
+{
+    char buffer[STRING_FLOAT_LENGTH];
+    int length = snprintf(buffer, sizeof(buffer), "%a", value);
+    if(length < 0 || (size_t) length >= sizeof(buffer)) {
+        return E_INT;
+    }
+
+    str_view_t view = { buffer, length };
+    return str_append_view(str, view);
+}
+
+char *str_detach(string_t *str)
+{
+    char *ptr = str->ptr;
+    if(!str_on_heap(str)) {
+        ptr = malloc(str->length + 1);
+        if(ptr != NULL) {
+            memcpy(ptr, str->ptr, str->length);
+            ptr[str->length] = '\0';
+        }
+    }
+    str->ptr = NULL;
+    str->alloc_length = str->length = 0;
+    return ptr;
+}
+
 void str_free(string_t *str)
 {
-    if(str->ptr) {
+    if(str_on_heap(str)) {
         free(str->ptr);
     }
 }
+
+int str_view_cmp(str_view_t view, const char *s)
+{
+    size_t length = strlen(s);
+    int cmp = memcmp(view.ptr, s, view.length < length ? view.length : length);
+    if(cmp || view.length == length) {
+        return cmp;
+    }
+    return view.length < length ? -1 : 1;
+}
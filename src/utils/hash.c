@@ -0,0 +1,141 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file hash.c
+ *
+ * @brief String hash functions
+ */
+#include "hash.h"
+
+/// odd constants with well spread bits, taken from wyhash
+#define HASH_P0 0xa0761d6478bd642fULL
+#define HASH_P1 0xe7037ed1a0b428dbULL
+#define HASH_P2 0x8ebc6af09c88c6e3ULL
+#define HASH_P3 0x589965cc75374cc3ULL
+
+/**
+ * @brief Reads 8 bytes from possibly unaligned address
+ */
+static inline uint64_t read64(const char *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * @brief Reads 4 bytes from possibly unaligned address
+ */
+static inline uint64_t read32(const char *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * @brief Multiplies a and b to 128 bits, returns xor of both halves
+ */
+static inline uint64_t mum(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128_t;
+    uint128_t r = (uint128_t) a * b;
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+#else
+    uint64_t ha = a >> 32, la = (uint32_t) a, hb = b >> 32, lb = (uint32_t) b;
+    uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    uint64_t mid = (ll >> 32) + (uint32_t) hl + (uint32_t) lh;
+    uint64_t lo = (mid << 32) | (uint32_t) ll;
+    uint64_t hi = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+    return lo ^ hi;
+#endif
+}
+
+uint64_t hash_fnv1a(const char *s, size_t length)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for(size_t i = 0; i < length; i++) {
+        h ^= (unsigned char) s[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+uint64_t hash_wy(const char *s, size_t length)
+{
+    uint64_t seed = mum(HASH_P0, HASH_P1);
+    uint64_t a, b;
+    if(length <= 16) {
+        if(length >= 4) {
+            // two overlapping reads from each end cover 4 to 16 bytes
+            size_t shift = (length >> 3) << 2;
+            a = (read32(s) << 32) | read32(s + shift);
+            b = (read32(s + length - 4) << 32) | read32(s + length - 4 - shift);
+        } else if(length > 0) {
+            const unsigned char *u = (const unsigned char *) s;
+            a = ((uint64_t) u[0] << 16) | ((uint64_t) u[length >> 1] << 8) | u[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = length;
+        const char *p = s;
+        for(; i > 16; i -= 16, p += 16) {
+            seed = mum(read64(p) ^ HASH_P1, read64(p + 8) ^ seed);
+        }
+        // the last 16 bytes, may overlap the ones already mixed
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+    return mum(HASH_P1 ^ length, mum(a ^ HASH_P1, b ^ seed));
+}
+
+uint64_t hash_mix(const char *s, size_t length)
+{
+    uint64_t lanes[4] = { HASH_P0, HASH_P1, HASH_P2, HASH_P3 };
+    size_t i = 0;
+    // no dependency between lanes, the loop body maps onto vector multiplications
+    for(; i + 32 <= length; i += 32) {
+        for(int k = 0; k < 4; k++) {
+            uint64_t v = read64(s + i + 8 * k);
+            lanes[k] = (lanes[k] ^ v) * HASH_P0;
+            lanes[k] ^= lanes[k] >> 29;
+        }
+    }
+    for(int k = 0; i + 8 <= length; i += 8, k++) {
+        lanes[k] = (lanes[k] ^ read64(s + i)) * HASH_P0;
+        lanes[k] ^= lanes[k] >> 29;
+    }
+    if(i < length) {
+        // fixed size reads are cheaper than copying the exact rest
+        uint64_t v;
+        if(length >= 8) {
+            v = read64(s + length - 8);
+        } else if(length >= 4) {
+            v = (read32(s) << 32) | read32(s + length - 4);
+        } else {
+            const unsigned char *u = (const unsigned char *) s;
+            v = ((uint64_t) u[0] << 16) | ((uint64_t) u[length >> 1] << 8) | u[length - 1];
+        }
+        lanes[3] = (lanes[3] ^ v) * HASH_P0;
+        lanes[3] ^= lanes[3] >> 29;
+    }
+
+    uint64_t h = mum(lanes[0] ^ length, lanes[1]) ^ mum(lanes[2], lanes[3] ^ HASH_P2);
+    // murmur3 finalizer
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
@@ -0,0 +1,104 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xruzaa00 Adam Ruza
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file pool.c
+ *
+ * @brief Fixed size object allocator, objects come from slabs and are recycled by a free list
+ */
+#include "pool.h"
+
+#include <stdalign.h>
+#include <stdlib.h>
+
+/// number of objects in the first slab
+#define POOL_MIN_SLAB_OBJECTS (32)
+/// slabs stop growing at this number of objects
+#define POOL_MAX_SLAB_OBJECTS (4096)
+
+struct pool_slab {
+    pool_slab_t *next;  ///< previously carved slab
+    max_align_t data[]; ///< slab memory
+};
+
+/**
+ * @brief Object size rounded up so that objects are aligned and fit a free list link
+ */
+static size_t pool_stride(const pool_t *pool)
+{
+    size_t size = pool->object_size < sizeof(void *) ? sizeof(void *) : pool->object_size;
+    return (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+}
+
+static int pool_grow(pool_t *pool)
+{
+    if(pool->slab_objects < POOL_MIN_SLAB_OBJECTS) {
+        pool->slab_objects = POOL_MIN_SLAB_OBJECTS;
+    }
+    size_t size = pool->slab_objects * pool_stride(pool);
+    pool_slab_t *slab = malloc(sizeof(pool_slab_t) + size);
+    if(!slab) {
+        return 1;
+    }
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->cursor = (char *) slab->data;
+    pool->end = pool->cursor + size;
+    pool->stats.slabs++;
+    if(pool->slab_objects < POOL_MAX_SLAB_OBJECTS) {
+        pool->slab_objects *= 2;
+    }
+    return 0;
+}
+
+void *pool_alloc(pool_t *pool)
+{
+    void *object = pool->free_list;
+    if(object) {
+        pool->free_list = *(void **) object;
+    } else {
+        if(pool->cursor == pool->end && pool_grow(pool)) {
+            return NULL;
+        }
+        object = pool->cursor;
+        pool->cursor += pool_stride(pool);
+    }
+
+    pool->stats.live++;
+    if(pool->stats.live > pool->stats.peak) {
+        pool->stats.peak = pool->stats.live;
+    }
+    return object;
+}
+
+void pool_release(pool_t *pool, void *object)
+{
+    if(!object) {
+        return;
+    }
+    *(void **) object = pool->free_list;
+    pool->free_list = object;
+    pool->stats.live--;
+}
+
+void pool_free(pool_t *pool)
+{
+    while(pool->slabs) {
+        pool_slab_t *next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+    pool->free_list = NULL;
+    pool->cursor = NULL;
+    pool->end = NULL;
+    pool->slab_objects = 0;
+    pool->stats.live = 0;
+    pool->stats.peak = 0;
+    pool->stats.slabs = 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * IFJ21 Compiler
+ *
+ *  Copyright 2021 xkrato61 Pavel Kratochvil
+ *
+ *  Licensed under GNU General Public License 3.0 or later.
+ *  Some rights reserved. See COPYING, AUTHORS.
+ *
+ * @license GPL-3.0+ <http://spdx.org/licenses/GPL-3.0+>
+ *
+ * @file source.c
+ *
+ * @brief Whole-file source reader
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "source.h"
+#include "error.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SOURCE_BLOCK_LENGTH 65536
+
+/**
+ * @brief Maps a regular file into memory.
+ *
+ * @return E_OK if the file was mapped, otherwise E_INT
+ */
+static int source_map(source_t *source, FILE *file)
+{
+    struct stat st;
+    int fd = fileno(file);
+    if(fd < 0 || fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+        return E_INT;
+    }
+
+    // the stream might have been read from already
+    if(ftello(file) != 0) {
+        return E_INT;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(data == MAP_FAILED) {
+        return E_INT;
+    }
+    posix_madvise(data, st.st_size, POSIX_MADV_SEQUENTIAL);
+
+    source->data = data;
+    source->length = st.st_size;
+    source->mapped = true;
+    return E_OK;
+}
+
+/**
+ * @brief Reads the stream in blocks into a growing heap buffer.
+ */
+static int source_read(source_t *source, FILE *file)
+{
+    size_t capacity = SOURCE_BLOCK_LENGTH;
+    size_t length = 0;
+    char *data = malloc(capacity);
+    if(!data) {
+        return E_INT;
+    }
+
+    size_t read;
+    while((read = fread(data + length, 1, capacity - length, file)) > 0) {
+        length += read;
+        if(length == capacity) {
+            char *tmp = realloc(data, capacity * 2);
+            if(!tmp) {
+                free(data);
+                return E_INT;
+            }
+            data = tmp;
+            capacity *= 2;
+        }
+    }
+    if(ferror(file)) {
+        free(data);
+        return E_INT;
+    }
+
+    source->data = data;
+    source->length = length;
+    source->mapped = false;
+    return E_OK;
+}
+
+int source_open(source_t *source, FILE *file)
+{
+    source->data = NULL;
+    source->length = 0;
+    source->mapped = false;
+    source->lines = NULL;
+    source->line_count = 0;
+
+    if(!file) {
+        return E_INT;
+    }
+    if(source_map(source, file) == E_OK) {
+        return E_OK;
+    }
+    return source_read(source, file);
+}
+
+void source_close(source_t *source)
+{
+    if(source->mapped) {
+        munmap((void *) source->data, source->length);
+    } else {
+        free((void *) source->data);
+    }
+    free(source->lines);
+    source->data = NULL;
+    source->length = 0;
+    source->mapped = false;
+    source->lines = NULL;
+    source->line_count = 0;
+}
+
+/**
+ * @brief Builds the index of line starts.
+ *
+ * @return E_OK on success, E_INT on allocation error
+ */
+static int source_index_lines(source_t *source)
+{
+    const char *end = source->data + source->length;
+    size_t count = 1;
+    for(const char *p = source->data; p < end && (p = memchr(p, '\n', end - p)); p++) {
+        count++;
+    }
+
+    source->lines = malloc(count * sizeof(size_t));
+    if(!source->lines) {
+        return E_INT;
+    }
+    source->lines[0] = 0;
+    source->line_count = 1;
+    for(const char *p = source->data; p < end && (p = memchr(p, '\n', end - p)); p++) {
+        source->lines[source->line_count++] = p + 1 - source->data;
+    }
+    return E_OK;
+}
+
+source_position_t source_position(source_t *source, size_t offset)
+{
+    source_position_t position = { 0, 0 };
+    if(!source->lines && source_index_lines(source)) {
+        return position;
+    }
+
+    // last line starting at or before offset
+    size_t low = 0, high = source->line_count;
+    while(high - low > 1) {
+        size_t mid = low + (high - low) / 2;
+        if(source->lines[mid] <= offset) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    position.row = low + 1;
+    position.column = offset - source->lines[low] + 1;
+    return position;
+}
@@ -0,0 +1,37 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "arena.h"
+}
+
+TEST(Arena, AllocZeroedAndAligned)
+{
+    arena_t arena = {};
+    for(size_t size = 1; size < 100; size++) {
+        unsigned char *ptr = (unsigned char *) arena_alloc(&arena, size);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ((uintptr_t) ptr % alignof(max_align_t), 0u);
+        for(size_t i = 0; i < size; i++) {
+            EXPECT_EQ(ptr[i], 0);
+        }
+        memset(ptr, 0xff, size);
+    }
+    arena_free(&arena);
+}
+
+TEST(Arena, LargeAllocations)
+{
+    arena_t arena = {};
+    char *small = (char *) arena_alloc(&arena, 16);
+    ASSERT_NE(small, nullptr);
+    char *large = (char *) arena_alloc(&arena, 1 << 20);
+    ASSERT_NE(large, nullptr);
+    large[(1 << 20) - 1] = 'x';
+    EXPECT_NE(arena_alloc(&arena, 16), nullptr);
+    arena_free(&arena);
+
+    // arena stays usable after release
+    EXPECT_NE(arena_alloc(&arena, 16), nullptr);
+    arena_free(&arena);
+}
@@ -2,6 +2,7 @@
 #include <string.h>
 
 #include <gtest/gtest.h>
+#include <string>
 extern "C" {
 #include "dynstring.h"
 }
@@ -52,6 +53,26 @@ TEST(StringCreation, CreateFromHugeString)
     EXPECT_EQ(strcmp(sample_string, str.ptr), 0);
     str_free(&str);
 }
+TEST(StringCreation, CreateFromView)
+{
+    const char *sample_string = "local a : integer";
+    str_view_t view = { sample_string + 6, 1 };
+
+    string_t str;
+    ASSERT_EQ(str_create_view(view, &str), 0);
+    EXPECT_EQ(strcmp(str.ptr, "a"), 0);
+    EXPECT_EQ(str.length, 1);
+    str_free(&str);
+}
+
+TEST(StringView, Compare)
+{
+    str_view_t view = { "integer", 3 };
+    EXPECT_EQ(str_view_cmp(view, "int"), 0);
+    EXPECT_LT(str_view_cmp(view, "integer"), 0);
+    EXPECT_GT(str_view_cmp(view, "in"), 0);
+    EXPECT_NE(str_view_cmp(view, "inf"), 0);
+}
 
 TEST_F(EmptyString, CheckNullByte)
 {
@@ -79,3 +100,121 @@ TEST_F(EmptyString, AppendCharMultiple)
     EXPECT_EQ(str.length, str_size);
     EXPECT_EQ(str.ptr[str_size], '\0');
 }
+TEST_F(EmptyString, AppendView)
+{
+    const char *sample_string = "in a tiny lived a tiny chick...";
+    str_view_t view = { sample_string, strlen(sample_string) };
+
+    ASSERT_EQ(str_append_char(&str, '>'), 0);
+    ASSERT_EQ(str_append_view(&str, view), 0);
+    ASSERT_EQ(str_append_view(&str, view), 0);
+    EXPECT_EQ(str.length, 1 + 2 * view.length);
+    EXPECT_EQ(std::string(str.ptr), std::string(">") + sample_string + sample_string);
+}
+
+TEST(StringSmall, StaysInline)
+{
+    string_t str;
+    ASSERT_EQ(str_create("identifier", &str), 0);
+    EXPECT_EQ(str.ptr, str.small);
+
+    // the inline buffer fits STRING_SMALL_LENGTH - 1 chars and the null byte
+    while(str.length < STRING_SMALL_LENGTH - 1) {
+        ASSERT_EQ(str_append_char(&str, 'x'), 0);
+    }
+    EXPECT_EQ(str.ptr, str.small);
+
+    ASSERT_EQ(str_append_char(&str, 'y'), 0);
+    EXPECT_NE(str.ptr, str.small);
+    EXPECT_EQ(std::string(str.ptr), "identifierxxxxxy");
+    str_free(&str);
+}
+
+TEST(StringSmall, Detach)
+{
+    string_t str;
+    ASSERT_EQ(str_create("short", &str), 0);
+    char *ptr = str_detach(&str);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_NE(ptr, str.small);
+    EXPECT_STREQ(ptr, "short");
+    free(ptr);
+
+    std::string long_string(100, 'l');
+    ASSERT_EQ(str_create(long_string.c_str(), &str), 0);
+    const char *heap = str.ptr;
+    ptr = str_detach(&str);
+    EXPECT_EQ(ptr, heap);
+    EXPECT_EQ(std::string(ptr), long_string);
+    free(ptr);
+}
+
+TEST(StringSmall, CopiesBorrow)
+{
+    string_t str;
+    ASSERT_EQ(str_create("short", &str), 0);
+    string_t copy = str;
+    // the copy points into the small buffer of str, there is nothing to free
+    str_free(&copy);
+    EXPECT_STREQ(str.ptr, "short");
+
+    copy = str;
+    ASSERT_EQ(str_append_cstr(&copy, " and now much longer"), 0);
+    EXPECT_STREQ(copy.ptr, "short and now much longer");
+    EXPECT_STREQ(str.ptr, "short");
+    str_free(&copy);
+    str_free(&str);
+}
+
+TEST(StringBorrowed, AppendCopies)
+{
+    char buffer[] = "borrowed";
+    string_t str = {};
+    str.ptr = buffer;
+    str.length = strlen(buffer);
+    str_free(&str);
+
+    ASSERT_EQ(str_append_char(&str, '!'), 0);
+    EXPECT_NE(str.ptr, buffer);
+    EXPECT_STREQ(str.ptr, "borrowed!");
+    EXPECT_STREQ(buffer, "borrowed");
+    str_free(&str);
+}
+
+TEST(StringBuilder, AppendFormatted)
+{
+    string_t str;
+    ASSERT_EQ(str_create_empty(&str), 0);
+    ASSERT_EQ(str_append_cstr(&str, "x%"), 0);
+    ASSERT_EQ(str_append_int(&str, 0), 0);
+    ASSERT_EQ(str_append_char(&str, ' '), 0);
+    ASSERT_EQ(str_append_int(&str, -42), 0);
+    ASSERT_EQ(str_append_char(&str, ' '), 0);
+    ASSERT_EQ(str_append_int(&str, INT64_MIN), 0);
+    ASSERT_EQ(str_append_char(&str, ' '), 0);
+    ASSERT_EQ(str_append_float(&str, 0.5), 0);
+    EXPECT_EQ(std::string(str.ptr), "x%0 -42 -9223372036854775808 0x1p-1");
+    EXPECT_EQ(str.length, strlen(str.ptr));
+    str_free(&str);
+}
+
+TEST(StringBuilder, ReserveAndAppendString)
+{
+    string_t part;
+    ASSERT_EQ(str_create("0123456789", &part), 0);
+
+    string_t str;
+    ASSERT_EQ(str_create_empty(&str), 0);
+    ASSERT_EQ(str_reserve(&str, 100 * part.length), 0);
+    const char *buffer = str.ptr;
+    for(int i = 0; i < 100; i++) {
+        ASSERT_EQ(str_append_str(&str, &part), 0);
+    }
+    // nothing was reallocated
+    EXPECT_EQ(str.ptr, buffer);
+    EXPECT_EQ(str.length, 100 * part.length);
+    EXPECT_EQ(str.ptr[str.length], '\0');
+
+    str_free(&part);
+    str_free(&str);
+}
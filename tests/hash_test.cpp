@@ -0,0 +1,230 @@
+#include <chrono>
+#include <cmath>
+#include <dirent.h>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "error.h"
+#include "hash.h"
+#include "typed_hashtable.h"
+}
+
+struct named_hash {
+    const char *name;
+    hash_bytes_t function;
+};
+
+/**
+ * @brief Shift-xor hash the symtable and codegen used to copy, kept as a baseline
+ */
+static uint64_t hash_shift_xor(const char *s, size_t length)
+{
+    uint64_t h = 0;
+    for(size_t i = 0; i < length; i++) {
+        h = ((h << 5) ^ (h >> 27)) ^ s[i];
+    }
+    return h;
+}
+
+static const named_hash hashes[] = {
+    { "shift-xor", hash_shift_xor },
+    { "fnv1a", hash_fnv1a },
+    { "wy", hash_wy },
+    { "mix", hash_mix },
+};
+
+TEST(Hash, Fnv1aReference)
+{
+    EXPECT_EQ(hash_fnv1a("", 0), 0xcbf29ce484222325ULL);
+    EXPECT_EQ(hash_fnv1a("a", 1), 0xaf63dc4c8601ec8cULL);
+    EXPECT_EQ(hash_fnv1a("foobar", 6), 0x85944171f73967e8ULL);
+}
+
+TEST(Hash, DependsOnEveryByte)
+{
+    // lengths around every read width and block boundary
+    std::string base(80, 'x');
+    for(const named_hash &h : hashes) {
+        if(h.function == hash_shift_xor) {
+            continue;
+        }
+        std::set<uint64_t> seen;
+        size_t count = 0;
+        for(size_t length = 0; length <= base.size(); length++) {
+            std::string s = base.substr(0, length);
+            EXPECT_EQ(h.function(s.c_str(), length), h.function(s.data(), length));
+            seen.insert(h.function(s.data(), length));
+            count++;
+            for(size_t i = 0; i < length; i++) {
+                std::string flipped = s;
+                flipped[i] = 'y';
+                seen.insert(h.function(flipped.data(), length));
+                count++;
+            }
+        }
+        EXPECT_EQ(seen.size(), count) << h.name;
+    }
+}
+
+TEST(Hash, IgnoresBytesPastLength)
+{
+    const char a[] = "identifier_one";
+    const char b[] = "identifier_two";
+    for(const named_hash &h : hashes) {
+        EXPECT_EQ(h.function(a, 11), h.function(b, 11)) << h.name;
+        EXPECT_NE(h.function(a, 14), h.function(b, 14)) << h.name;
+    }
+}
+
+/**
+ * @brief Collects distinct identifiers of all testoid programs
+ */
+static std::vector<std::string> harvest_identifiers()
+{
+    std::set<std::string> identifiers;
+    const std::string root = "testoid/test_cases/";
+    DIR *dir = opendir(root.c_str());
+    if(!dir) {
+        return {};
+    }
+    while(struct dirent *entry = readdir(dir)) {
+        std::ifstream file(root + entry->d_name + "/program.tl");
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string text = buffer.str();
+        for(size_t i = 0; i < text.size();) {
+            if(isalpha((unsigned char) text[i]) || text[i] == '_') {
+                size_t start = i;
+                while(i < text.size() && (isalnum((unsigned char) text[i]) || text[i] == '_')) {
+                    i++;
+                }
+                identifiers.insert(text.substr(start, i - start));
+            } else {
+                i++;
+            }
+        }
+    }
+    closedir(dir);
+    return std::vector<std::string>(identifiers.begin(), identifiers.end());
+}
+
+/**
+ * @brief Keys colliding in a table of size buckets, relative to a random function
+ *
+ * @param mask index by the low bits instead of modulo, size has to be a power of two
+ * @return 1 for as many collisions as a random function, more is worse
+ */
+static double collision_ratio(hash_bytes_t function, const std::vector<std::string> &corpus,
+                              size_t size, bool mask)
+{
+    std::vector<bool> used(size);
+    size_t collisions = 0;
+    for(const std::string &s : corpus) {
+        uint64_t h = function(s.data(), s.size());
+        size_t index = mask ? h & (size - 1) : h % size;
+        collisions += used[index];
+        used[index] = true;
+    }
+    double n = corpus.size();
+    double expected = n - size * (1 - std::pow(1 - 1.0 / size, n));
+    return collisions / expected;
+}
+
+static size_t next_prime(size_t n)
+{
+    for(;; n++) {
+        bool prime = n > 1;
+        for(size_t d = 2; d * d <= n && prime; d++) {
+            prime = n % d != 0;
+        }
+        if(prime) {
+            return n;
+        }
+    }
+}
+
+static hash_bytes_t selected;
+
+static uint64_t selected_cstr(const char *s)
+{
+    return selected(s, strlen(s));
+}
+
+static bool equal_cstr(const char *a, const char *b)
+{
+    return strcmp(a, b) == 0;
+}
+
+DEFINE_HASHTABLE(string_map, const char *, size_t, selected_cstr, equal_cstr)
+
+/**
+ * @brief Looks every identifier of corpus up rounds times in a table hashed by function
+ *
+ * @return millions of lookups per second
+ */
+static double lookup_rate(hash_bytes_t function, const std::vector<std::string> &corpus,
+                          size_t rounds)
+{
+    selected = function;
+    string_map_t map;
+    if(string_map_create(&map, 8) != E_OK) {
+        throw std::bad_alloc();
+    }
+    for(size_t i = 0; i < corpus.size(); i++) {
+        string_map_insert(&map, corpus[i].c_str(), i);
+    }
+
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(const std::string &s : corpus) {
+            found += string_map_find(&map, s.c_str()) != NULL;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(found, rounds * corpus.size());
+
+    string_map_free(&map);
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return rounds * corpus.size() / seconds / 1e6;
+}
+
+static void report(const char *corpus_name, const std::vector<std::string> &corpus, size_t rounds)
+{
+    // tables about half full, like the ones the compiler keeps
+    size_t prime = next_prime(2 * corpus.size());
+    size_t power = 1;
+    while(power < 2 * corpus.size()) {
+        power *= 2;
+    }
+    std::cout << "[ BENCH    ] " << corpus_name << ": " << corpus.size()
+              << " identifiers, collisions relative to random (% " << prime << ", & "
+              << power - 1 << "), Mlookups/s" << std::endl;
+    for(const named_hash &h : hashes) {
+        std::cout << "[ BENCH    ]   " << h.name << ": "
+                  << collision_ratio(h.function, corpus, prime, false) << ", "
+                  << collision_ratio(h.function, corpus, power, true) << ", "
+                  << lookup_rate(h.function, corpus, rounds) << std::endl;
+    }
+}
+
+TEST(HashBenchmark, DISABLED_Identifiers)
+{
+    std::vector<std::string> testoid = harvest_identifiers();
+    if(testoid.empty()) {
+        GTEST_SKIP() << "testoid/test_cases not found";
+    }
+    report("testoid", testoid, 2000);
+
+    // names generated by the compiler differ only in their numeric suffix
+    std::vector<std::string> generated;
+    for(int i = 0; i < 1000; i++) {
+        generated.push_back("%tmp" + std::to_string(i));
+    }
+    report("generated", generated, 2000);
+}
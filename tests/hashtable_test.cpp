@@ -1,112 +1,91 @@
+#include <chrono>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 extern "C" {
-#include "hashtable_bst.h"
+#include "atom.h"
+#include "typed_hashtable.h"
 #include "error.h"
 }
 
-static uint64_t hash(const char *key)
-{
-    uint64_t h = 0;
-    for(const char *c = key; *c != '\0'; ++c) {
-        h = ((h << 5) ^ (h >> 27)) ^ *c;
-    }
-    return h;
-}
+DEFINE_HASHTABLE(atom_map, atom_t, size_t, atom_hash, atom_equal)
 
-class HashtableEmpty : public ::testing::Test {
-
-  protected:
-    hashtable_t map;
-
-    virtual void SetUp() override
-    {
-        if(hashtable_create_bst(&map, 43, hash) != E_OK) {
-            throw std::bad_alloc();
-        }
+TEST(TypedHashtable, InsertFindErase)
+{
+    std::vector<atom_t> atoms;
+    for(size_t i = 0; i < 1000; i++) {
+        atoms.push_back(atom_intern_cstr(("typed_" + std::to_string(i)).c_str()));
+        ASSERT_NE(atoms.back(), nullptr);
     }
 
-    virtual void TearDown() override
-    {
-        hashtable_free(&map);
+    atom_map_t map;
+    ASSERT_EQ(atom_map_create(&map, 8), E_OK);
+    EXPECT_TRUE(atom_map_empty(&map));
+    for(size_t i = 0; i < atoms.size(); i++) {
+        ASSERT_EQ(atom_map_insert(&map, atoms[i], i), E_OK);
     }
+    EXPECT_EQ(map.load, atoms.size());
+    EXPECT_LE(4 * map.load, 3 * map.size);
 
-    void insert(const char *key, int *data)
-    {
-        EXPECT_EQ(hashtable_insert(&map, key, data), E_OK);
-    };
-
-    void find(const char *key, int value)
-    {
-        int *get;
-        EXPECT_EQ(hashtable_find(&map, key, (void **) &get), E_OK);
-        EXPECT_EQ(*get, value);
-    };
+    // replacing doesn't add an entry
+    ASSERT_EQ(atom_map_insert(&map, atoms[0], 1000), E_OK);
+    EXPECT_EQ(map.load, atoms.size());
 
-    void findNull(const char *key)
-    {
-        int *get;
-        EXPECT_EQ(hashtable_find(&map, key, (void **) &get), E_INT);
+    for(size_t i = 0; i < atoms.size(); i += 2) {
+        atom_map_erase(&map, atoms[i]);
     }
-};
-
-TEST(Hashtable, Create)
-{
-    hashtable_t map;
-    EXPECT_EQ(hashtable_create_bst(&map, 43, hash), E_OK);
-    hashtable_free(&map);
+    for(size_t i = 0; i < atoms.size(); i++) {
+        size_t *value = atom_map_find(&map, atoms[i]);
+        if(i % 2) {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, i);
+        } else {
+            EXPECT_EQ(value, nullptr);
+        }
+    }
+    EXPECT_EQ(map.load, atoms.size() / 2);
+    atom_map_free(&map);
 }
 
-TEST_F(HashtableEmpty, Insert)
+/**
+ * @brief Inserts n atoms, then looks them up in turn, lookups times in total
+ *
+ * @return nanoseconds per lookup
+ */
+static double bench_lookup(const std::vector<atom_t> &atoms, size_t n, size_t lookups)
 {
-    int d1 = 1, d2 = 2, d3 = 3, d4 = 4;
-    insert("key1", &d1);
-    insert("key2", &d2);
-    insert("key3", &d3);
-    insert("key4", &d4);
-
-    find("key1", 1);
-    find("key2", 2);
-    find("key3", 3);
-    find("key4", 4);
+    atom_map_t map;
+    if(atom_map_create(&map, 101) != E_OK) {
+        throw std::bad_alloc();
+    }
+    for(size_t i = 0; i < n; i++) {
+        atom_map_insert(&map, atoms[i], i);
+    }
 
-    int *get;
-    EXPECT_EQ(hashtable_find(&map, "k5", (void **) &get), E_INT);
-}
+    auto start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for(size_t i = 0; i < lookups; i++) {
+        found += atom_map_find(&map, atoms[i % n]) != NULL;
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(found, lookups);
 
-TEST_F(HashtableEmpty, IsEmpty)
-{
-    EXPECT_TRUE(hashtable_empty(&map));
-    int d1 = 1;
-    insert("key1", &d1);
-    EXPECT_FALSE(hashtable_empty(&map));
-    EXPECT_GT(hashtable_load_factor(&map), 0.0);
+    atom_map_free(&map);
+    return std::chrono::duration<double, std::nano>(end - start).count() / lookups;
 }
 
-TEST_F(HashtableEmpty, Erase)
+TEST(HashtableBenchmark, DISABLED_Scaling)
 {
-    int d1 = 1, d2 = 2, d3 = 3, d4 = 4;
-    insert("key1", &d1);
-    insert("key2", &d2);
-    insert("key3", &d3);
-    insert("key4", &d4);
-
-    hashtable_erase(&map, "key2");
-    find("key1", 1);
-    findNull("key2");
-    find("key3", 3);
-    find("key4", 4);
-
-    hashtable_erase(&map, "key1");
-    findNull("key1");
-    find("key3", 3);
-    find("key4", 4);
-
-    hashtable_erase(&map, "key3");
-    findNull("key3");
-    find("key4", 4);
+    std::vector<atom_t> atoms;
+    for(size_t i = 0; i < 100000; i++) {
+        atoms.push_back(atom_intern_cstr(("identifier_" + std::to_string(i)).c_str()));
+        ASSERT_NE(atoms.back(), nullptr);
+    }
 
-    hashtable_erase(&map, "key4");
-    findNull("key4");
+    for(size_t n : { 100, 1000, 10000, 100000 }) {
+        std::cout << "[ BENCH    ] " << n << " keys: " << bench_lookup(atoms, n, 200000)
+                  << " ns/lookup" << std::endl;
+    }
 }
@@ -1,8 +1,15 @@
+#include <chrono>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
+#include <fcntl.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
 extern "C" {
 #include <stdarg.h>
+#include "codegen.h"
+#include "optimizations.h"
 #include "parser.h"
 #include "scanner.h"
 #include "semantics.h"
@@ -50,10 +57,6 @@ class ParserTests : public ::testing::Test {
 
         // throw exception if allocation failed
         scanner_init(fp);
-        if(parser_init()) {
-            throw std::bad_alloc();
-        }
-
         if(semantics_init()) {
             throw std::bad_alloc();
         }
@@ -67,9 +70,8 @@ class ParserTests : public ::testing::Test {
     }
     virtual void TearDown() override
     {
-        free_ast(ast);
+        ast_free();
         semantics_free();
-        parser_free();
         scanner_free();
     }
 
@@ -82,12 +84,12 @@ class ParserTests : public ::testing::Test {
     EXPECT_EQ(node->node_type, AST_NODE_STRING);                                                   \
     EXPECT_EQ(strcmp(node->string.ptr, str), 0);
 
-#define check_sym_node(node, str)                                                                  \
+#define check_sym_node(node, c_str)                                                                \
     ASSERT_NE(node, nullptr);                                                                      \
     EXPECT_EQ(node->node_type, AST_NODE_SYMBOL);                                                   \
-    EXPECT_EQ(strcmp(node->symbol.is_declaration ? node->symbol.name.ptr                           \
-                                                 : node->symbol.declaration->name.ptr,             \
-                     str),                                                                         \
+    EXPECT_EQ(strcmp(node->symbol.is_declaration ? node->symbol.name->str                          \
+                                                 : node->symbol.declaration->name->str,            \
+                     c_str),                                                                       \
               0);
 
 // node_type has to be asserted, because usually nodes have children and this wouldn't end well
@@ -95,7 +97,7 @@ class ParserTests : public ::testing::Test {
     ASSERT_NE(node, nullptr);                                                                      \
     ASSERT_EQ(node->node_type, type);
 
-#define check_str(str, c_str) EXPECT_EQ(strcmp(str.ptr, c_str), 0);
+#define check_str(atom, c_str) EXPECT_EQ(strcmp(atom->str, c_str), 0);
 
 void check_arg_names(ast_func_def_t func_def, ...)
 {
@@ -113,7 +115,7 @@ void check_arg_names(ast_func_def_t func_def, ...)
 
         EXPECT_EQ(arg_list->node_type, AST_NODE_SYMBOL);
         EXPECT_TRUE(arg_list->symbol.is_declaration);
-        EXPECT_EQ(strcmp(arg_list->symbol.name.ptr, arg_name), 0);
+        EXPECT_EQ(strcmp(arg_list->symbol.name->str, arg_name), 0);
 
         arg_list = arg_list->next;
         arg_name = va_arg(args, const char *);
@@ -178,7 +180,7 @@ TEST_F(ParserTests, Add)
     check_node(global_it, AST_NODE_FUNC_DEF);
     ast_func_def_t func_def = global_it->func_def;
 
-    EXPECT_EQ(strcmp(func_def.name.ptr, "add"), 0);
+    EXPECT_EQ(strcmp(func_def.name->str, "add"), 0);
     check_arg_names(func_def, "a%1", "b%1", NULL);
     check_arg_types(func_def, TYPE_INTEGER, TYPE_INTEGER, TYPE_NIL);
     check_type_list(func_def.return_types, TYPE_INTEGER, TYPE_NIL);
@@ -339,3 +341,190 @@ TEST_F(ParserTests, Return)
 {
     InitTest("tests/test_files/returns.tl");
 }
+TEST_F(ParserTests, Expressions)
+{
+    InitTest("tests/test_files/expressions.tl");
+
+    ast_node_t *global_it = ast->program.global_statement_list;
+    check_node(global_it, AST_NODE_FUNC_DEF);
+    check_node(global_it->func_def.body, AST_NODE_BODY);
+    ast_node_t *statement_it = global_it->func_def.body->body.statements;
+
+    // 1 + (2 * (-3))
+    check_node(statement_it, AST_NODE_DECLARATION);
+    ast_node_t *expr = statement_it->declaration.assignment;
+    check_node(expr, AST_NODE_BINOP);
+    EXPECT_EQ(expr->binop.type, AST_NODE_BINOP_ADD);
+    check_node(expr->binop.left, AST_NODE_INTEGER);
+    EXPECT_EQ(expr->binop.left->integer, 1);
+    ast_node_t *mul = expr->binop.right;
+    check_node(mul, AST_NODE_BINOP);
+    EXPECT_EQ(mul->binop.type, AST_NODE_BINOP_MUL);
+    check_node(mul->binop.left, AST_NODE_INTEGER);
+    EXPECT_EQ(mul->binop.left->integer, 2);
+    check_node(mul->binop.right, AST_NODE_UNOP);
+    EXPECT_EQ(mul->binop.right->unop.type, AST_NODE_UNOP_NEG);
+    check_node(mul->binop.right->unop.operand, AST_NODE_INTEGER);
+    EXPECT_EQ(mul->binop.right->unop.operand->integer, 3);
+
+    // parentheses nested deeper than the parser stack holds without allocating
+    statement_it = statement_it->next;
+    check_node(statement_it, AST_NODE_DECLARATION);
+    expr = statement_it->declaration.assignment;
+    check_node(expr, AST_NODE_BINOP);
+    EXPECT_EQ(expr->binop.type, AST_NODE_BINOP_ADD);
+    check_node(expr->binop.left, AST_NODE_INTEGER);
+    EXPECT_EQ(expr->binop.left->integer, 5);
+    check_sym_node(expr->binop.right, "x%1");
+    EXPECT_EQ(statement_it->next, nullptr);
+}
+
+// number of functions in the generated benchmark program
+#define BENCH_FUNCTIONS 20000
+
+/**
+ * Generates a program of BENCH_FUNCTIONS functions.
+ */
+static std::string bench_program()
+{
+    std::string source = "require \"ifj21\"\n";
+    for(int i = 0; i < BENCH_FUNCTIONS; i++) {
+        std::string name = "fact" + std::to_string(i);
+        source += "function " + name + "(n : integer) : integer\n"
+                  "    local result : integer = 1 -- accumulator\n"
+                  "    while n > 1 do\n"
+                  "        result = result * (n + 0) // 1\n"
+                  "        n = n - 1\n"
+                  "    end\n"
+                  "    write(\"" + name + "\", n, 2.5e1)\n"
+                  "    return result\n"
+                  "end\n";
+    }
+    return source;
+}
+
+/**
+ * Lexes and parses source, lexing either all at once or on the pipeline thread.
+ *
+ * @return seconds spent in lexing before the parser started and seconds spent in total
+ */
+static std::pair<double, double> bench_parse(const std::string &source, bool pipelined)
+{
+    FILE *f = tmpfile();
+    EXPECT_NE(f, nullptr);
+    EXPECT_EQ(fwrite(source.data(), 1, source.size(), f), source.size());
+    rewind(f);
+
+    auto start = std::chrono::steady_clock::now();
+    scanner_init(f);
+    if(pipelined) {
+        EXPECT_EQ(scanner_pipeline(), E_OK);
+    } else {
+        EXPECT_EQ(scanner_tokenize(), E_OK);
+    }
+    auto lexed = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(semantics_init(), E_OK);
+    ast_node_t *ast = NULL;
+    EXPECT_EQ(parse(NT_PROGRAM, &ast, 0), E_OK);
+    auto parsed = std::chrono::steady_clock::now();
+
+    ast_free();
+    semantics_free();
+    scanner_free();
+
+    return { std::chrono::duration<double>(lexed - start).count(),
+             std::chrono::duration<double>(parsed - start).count() };
+}
+
+TEST(ParserBenchmark, DISABLED_LexThenParse)
+{
+    std::string source = bench_program();
+    double mib = (double) source.size() / (1 << 20);
+
+    auto batch = bench_parse(source, false);
+    std::cout << "[ BENCH    ] " << mib << " MiB: lexing " << (size_t)(mib / batch.first)
+              << " MiB/s, parsing " << (size_t)(mib / (batch.second - batch.first)) << " MiB/s"
+              << std::endl;
+
+    auto pipelined = bench_parse(source, true);
+    std::cout << "[ BENCH    ] " << mib << " MiB: lex then parse " << batch.second * 1000
+              << " ms, pipelined " << pipelined.second * 1000 << " ms" << std::endl;
+}
+
+// nesting depth of blocks in the deep benchmark program
+#define BENCH_NESTING 100000
+
+TEST(ParserBenchmark, DeepNesting)
+{
+    std::string source = "require \"ifj21\"\n"
+                         "function main()\n"
+                         "local n : integer = 1\n";
+    for(int i = 0; i < BENCH_NESTING; i++) {
+        source += i % 2 ? "while n > 0 do\n" : "if n > 0 then\n";
+    }
+    source += "n = n - 1\n";
+    for(int i = 0; i < BENCH_NESTING; i++) {
+        source += "end\n";
+    }
+    source += "end\n"
+              "main()\n";
+
+    FILE *f = tmpfile();
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(source.data(), 1, source.size(), f), source.size());
+    rewind(f);
+
+    auto start = std::chrono::steady_clock::now();
+    scanner_init(f);
+    ASSERT_EQ(semantics_init(), E_OK);
+    ast_node_t *ast = NULL;
+    ASSERT_EQ(parse(NT_PROGRAM, &ast, 0), E_OK);
+    auto parsed = std::chrono::steady_clock::now();
+
+    // walk down the innermost bodies
+    ast_node_t *body = ast->program.global_statement_list->func_def.body;
+    ast_node_t *statement = body->body.statements->next;
+    int depth = 0;
+    for(; statement->node_type != AST_NODE_ASSIGNMENT; depth++) {
+        if(statement->node_type == AST_NODE_IF) {
+            body = statement->if_condition.bodies;
+        } else {
+            ASSERT_EQ(statement->node_type, AST_NODE_WHILE);
+            body = statement->while_loop.body;
+        }
+        ASSERT_NE(body, nullptr);
+        statement = body->body.statements;
+        ASSERT_NE(statement, nullptr);
+    }
+    EXPECT_EQ(depth, BENCH_NESTING);
+
+    // the later passes walk the same depth
+    bool optimize = optimus_prime;
+    optimus_prime = true;
+    EXPECT_EQ(optimize_ast(ast), E_OK);
+    auto optimized = std::chrono::steady_clock::now();
+    optimus_prime = optimize;
+
+    fflush(stdout);
+    int out = dup(STDOUT_FILENO);
+    int null = open("/dev/null", O_WRONLY);
+    ASSERT_GE(out, 0);
+    ASSERT_GE(null, 0);
+    dup2(null, STDOUT_FILENO);
+    avengers_assembler(ast);
+    fflush(stdout);
+    dup2(out, STDOUT_FILENO);
+    close(null);
+    close(out);
+    auto generated = std::chrono::steady_clock::now();
+
+    ast_free();
+    semantics_free();
+    scanner_free();
+
+    typedef std::chrono::duration<double, std::milli> ms;
+    std::cout << "[ BENCH    ] nesting " << BENCH_NESTING << ": parse "
+              << ms(parsed - start).count() << " ms, optimize " << ms(optimized - parsed).count()
+              << " ms, generate " << ms(generated - optimized).count() << " ms" << std::endl;
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "atom.h"
+#include "error.h"
+#include "pool.h"
+#include "symtable.h"
+}
+
+TEST(Pool, AlignedAndDistinct)
+{
+    pool_t pool = {};
+    pool.object_size = 3;
+    std::set<char *> objects;
+    for(int i = 0; i < 1000; i++) {
+        char *object = (char *) pool_alloc(&pool);
+        ASSERT_NE(object, nullptr);
+        EXPECT_EQ((uintptr_t) object % alignof(max_align_t), 0u);
+        object[0] = object[1] = object[2] = 'x';
+        EXPECT_TRUE(objects.insert(object).second);
+    }
+    EXPECT_EQ(pool.stats.live, 1000u);
+    EXPECT_EQ(pool.stats.peak, 1000u);
+    pool_free(&pool);
+}
+
+TEST(Pool, ReusesReleased)
+{
+    pool_t pool = {};
+    pool.object_size = sizeof(double);
+    std::vector<void *> objects;
+    for(int i = 0; i < 100; i++) {
+        objects.push_back(pool_alloc(&pool));
+    }
+    size_t slabs = pool.stats.slabs;
+    for(void *object : objects) {
+        pool_release(&pool, object);
+    }
+    pool_release(&pool, NULL);
+    EXPECT_EQ(pool.stats.live, 0u);
+
+    std::set<void *> reused;
+    for(int i = 0; i < 100; i++) {
+        reused.insert(pool_alloc(&pool));
+    }
+    EXPECT_EQ(reused, std::set<void *>(objects.begin(), objects.end()));
+    EXPECT_EQ(pool.stats.slabs, slabs);
+    EXPECT_EQ(pool.stats.peak, 100u);
+
+    pool_free(&pool);
+    EXPECT_EQ(pool.stats.peak, 0u);
+    EXPECT_EQ(pool.stats.slabs, 0u);
+    // pool stays usable after release
+    EXPECT_NE(pool_alloc(&pool), nullptr);
+    EXPECT_EQ(pool.stats.slabs, 1u);
+    pool_free(&pool);
+}
+
+TEST(Pool, SymtableBindings)
+{
+    ASSERT_EQ(symtable_init(), E_OK);
+    pool_stats_t before = symtable_pool_stats();
+    int d = 0;
+    ASSERT_EQ(symtable_push_scope(), E_OK);
+    for(int i = 0; i < 50; i++) {
+        atom_t name = atom_intern_cstr(("pool" + std::to_string(i)).c_str());
+        ASSERT_EQ(symtable_put_symbol(name, (ast_node_t *) &d), E_OK);
+    }
+    EXPECT_EQ(symtable_pool_stats().live, before.live + 50);
+    ASSERT_EQ(symtable_pop_scope(), E_OK);
+    EXPECT_EQ(symtable_pool_stats().live, before.live);
+    symtable_free();
+    EXPECT_EQ(symtable_pool_stats().live, 0u);
+}
+
+TEST(PoolBenchmark, DISABLED_AgainstMalloc)
+{
+    // scope-like churn: allocate a batch of small objects, release all of them, repeat
+    const size_t rounds = 20000, batch = 64;
+    // symtable binding: identifier, data, shadowed binding and level
+    const size_t object_size = 4 * sizeof(void *);
+    std::vector<void *> objects(batch);
+
+    auto start = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < batch; i++) {
+            objects[i] = malloc(object_size);
+        }
+        for(size_t i = 0; i < batch; i++) {
+            free(objects[i]);
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    pool_t pool = {};
+    pool.object_size = object_size;
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < batch; i++) {
+            objects[i] = pool_alloc(&pool);
+        }
+        for(size_t i = 0; i < batch; i++) {
+            pool_release(&pool, objects[i]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(pool.stats.peak, batch);
+    pool_free(&pool);
+
+    double n = rounds * batch;
+    std::cout << "[ BENCH    ] alloc+release: malloc "
+              << std::chrono::duration<double, std::nano>(middle - start).count() / n
+              << " ns/op, pool "
+              << std::chrono::duration<double, std::nano>(end - middle).count() / n << " ns/op"
+              << std::endl;
+}
@@ -1,10 +1,21 @@
 #include <stdexcept>
 #include <string.h>
+#include <unistd.h>
 
+#include <cctype>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 extern "C" {
 #include "scanner.h"
+#include "scanner-keywords.h"
+#include "scanner-number.h"
+#include "scanner-skip.h"
+#include "source.h"
 #include "type.h"
 #include "error.h"
 #include "dynstring.h"
@@ -16,7 +27,7 @@ class ScannerInput : public ::testing::Test {
     virtual void UseFile(const char *filename)
     {
         FILE *f = fopen(filename, "r");
-        scanner_init(f);
+        ASSERT_EQ(scanner_init(f), E_OK);
     }
     virtual void TearDown() override
     {
@@ -35,15 +46,15 @@ TEST_F(ScannerInput, NumberScan)
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.integer, (int64_t) 123);
     EXPECT_EQ(token.token_type, T_INTEGER);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     for(int i = 0; i < 8; i++) {
         ASSERT_EQ(get_next_token(&token), E_OK);
         EXPECT_EQ(token.number, (double) numbers[i]);
         EXPECT_EQ(token.token_type, T_NUMBER);
-        EXPECT_EQ(token.row, pos_rows[i]);
-        EXPECT_EQ(token.column, 1);
+        EXPECT_EQ(token_position(&token).row, pos_rows[i]);
+        EXPECT_EQ(token_position(&token).column, 1);
     }
 }
 
@@ -60,8 +71,8 @@ TEST_F(ScannerInput, OperatorScan)
         ASSERT_EQ(get_next_token(&token), E_OK);
         EXPECT_EQ(token.token_type, terms[i]);
         // i + 1, because rows are numbered from one
-        EXPECT_EQ(token.row, i + 1);
-        EXPECT_EQ(token.column, 1);
+        EXPECT_EQ(token_position(&token).row, i + 1);
+        EXPECT_EQ(token_position(&token).column, 1);
     }
 }
 
@@ -76,8 +87,8 @@ TEST_F(ScannerInput, CommentScan)
     for(int i = 0; i < 3; i++) {
         ASSERT_EQ(get_next_token(&token), E_OK);
         EXPECT_EQ(token.integer, ints[i]);
-        EXPECT_EQ(token.row, pos_rows[i]);
-        EXPECT_EQ(token.column, pos_cols[i]);
+        EXPECT_EQ(token_position(&token).row, pos_rows[i]);
+        EXPECT_EQ(token_position(&token).column, pos_cols[i]);
     }
 }
 
@@ -93,34 +104,29 @@ TEST_F(ScannerInput, StringScan)
     const char *s5 = "Lorem ipsum dolor sit amet, consect";
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s1), 0);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s1), 0);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s2), 0);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 7);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s2), 0);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 7);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s3), 0);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s3), 0);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s4), 0);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s4), 0);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s5), 0);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 39);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s5), 0);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 39);
 }
 
 TEST_F(ScannerInput, EscapeScan)
@@ -132,17 +138,15 @@ TEST_F(ScannerInput, EscapeScan)
     const char *s2 = "0123456789";
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s1), 0);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s1), 0);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 1);
 
-    str_free(&token.string);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(strcmp(token.string.ptr, s2), 0);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, s2), 0);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 1);
 }
 
 TEST_F(ScannerInput, KeywordScan)
@@ -152,106 +156,101 @@ TEST_F(ScannerInput, KeywordScan)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_DO);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_ELSE);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_END);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_FUNCTION);
-    EXPECT_EQ(token.row, 4);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "_mem"), 0);
-    EXPECT_EQ(token.row, 5);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "_mem"), 0);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_GLOBAL);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "globalVariable"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "globalVariable"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "_alsoGlobalVar156"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 16);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "_alsoGlobalVar156"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 16);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IF);
-    EXPECT_EQ(token.row, 8);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 8);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "var_iable"), 0);
-    EXPECT_EQ(token.row, 9);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "var_iable"), 0);
+    EXPECT_EQ(token_position(&token).row, 9);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LOCAL);
-    EXPECT_EQ(token.row, 10);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 10);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_NIL);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_REQUIRE);
-    EXPECT_EQ(token.row, 12);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 12);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RETURN);
-    EXPECT_EQ(token.row, 13);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 13);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_THEN);
-    EXPECT_EQ(token.row, 14);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 14);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(token.row, 15);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 15);
+    EXPECT_EQ(token_position(&token).column, 1);
     EXPECT_EQ(token.token_type, T_WHILE);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
-    EXPECT_EQ(token.row, 16);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 16);
+    EXPECT_EQ(token_position(&token).column, 1);
     EXPECT_EQ(token.token_type, T_FOR);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "whileend"), 0);
-    EXPECT_EQ(token.row, 17);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "whileend"), 0);
+    EXPECT_EQ(token_position(&token).row, 17);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EOF);
-    EXPECT_EQ(token.row, 18);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 18);
+    EXPECT_EQ(token_position(&token).column, 1);
 }
 
 TEST_F(ScannerInput, ComplexProgram1)
@@ -261,290 +260,275 @@ TEST_F(ScannerInput, ComplexProgram1)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_REQUIRE);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "ifj21"), 0);
-    EXPECT_EQ(token.row, 1);
-    EXPECT_EQ(token.column, 9);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ifj21"), 0);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 9);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_FUNCTION);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "concat"), 0);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 10);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "concat"), 0);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 10);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 17);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 17);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "x"), 0);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 18);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "x"), 0);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 18);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 20);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 20);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_STRING);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 22);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 22);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 28);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 28);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "y"), 0);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 30);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "y"), 0);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 30);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 32);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 32);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_STRING);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 34);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 34);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 40);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 40);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 42);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 42);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_STRING);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 44);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 44);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 50);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 50);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_INTEGER);
-    EXPECT_EQ(token.row, 2);
-    EXPECT_EQ(token.column, 52);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 52);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RETURN);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "x"), 0);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 8);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "x"), 0);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 8);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_DOUBLE_DOT);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 10);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 10);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "y"), 0);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 13);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "y"), 0);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 13);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 14);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 14);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.integer, (int64_t) 0);
     EXPECT_EQ(token.token_type, T_INTEGER);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 16);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 16);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_END);
-    EXPECT_EQ(token.row, 3);
-    EXPECT_EQ(token.column, 18);
+    EXPECT_EQ(token_position(&token).row, 3);
+    EXPECT_EQ(token_position(&token).column, 18);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_FUNCTION);
-    EXPECT_EQ(token.row, 4);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    EXPECT_EQ(token.row, 4);
-    EXPECT_EQ(token.column, 10);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 10);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
-    EXPECT_EQ(token.row, 4);
-    EXPECT_EQ(token.column, 14);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 14);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
-    EXPECT_EQ(token.row, 4);
-    EXPECT_EQ(token.column, 15);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 15);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LOCAL);
-    EXPECT_EQ(token.row, 5);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "x"), 0);
-    EXPECT_EQ(token.row, 5);
-    EXPECT_EQ(token.column, 7);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "x"), 0);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 7);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
-    EXPECT_EQ(token.row, 5);
-    EXPECT_EQ(token.column, 9);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 9);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_STRING);
-    EXPECT_EQ(token.row, 5);
-    EXPECT_EQ(token.column, 11);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 11);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LOCAL);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "ret"), 0);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 7);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ret"), 0);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 7);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 10);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 10);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TYPE);
     EXPECT_EQ(token.type, TYPE_INTEGER);
-    EXPECT_EQ(token.row, 6);
-    EXPECT_EQ(token.column, 12);
+    EXPECT_EQ(token_position(&token).row, 6);
+    EXPECT_EQ(token_position(&token).column, 12);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "x"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "x"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 2);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 2);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "ret"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 4);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ret"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 4);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 8);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 8);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "concat"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 10);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "concat"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 10);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 16);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 16);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "ahoj"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 17);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ahoj"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 17);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 23);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 23);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "svete"), 0);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 25);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "svete"), 0);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 25);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
-    EXPECT_EQ(token.row, 7);
-    EXPECT_EQ(token.column, 32);
+    EXPECT_EQ(token_position(&token).row, 7);
+    EXPECT_EQ(token_position(&token).column, 32);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_END);
-    EXPECT_EQ(token.row, 8);
-    EXPECT_EQ(token.column, 1);
+    EXPECT_EQ(token_position(&token).row, 8);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    EXPECT_EQ(token.row, 9);
-    EXPECT_EQ(token.column, 1);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
+    EXPECT_EQ(token_position(&token).row, 9);
+    EXPECT_EQ(token_position(&token).column, 1);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
-    EXPECT_EQ(token.row, 9);
-    EXPECT_EQ(token.column, 5);
+    EXPECT_EQ(token_position(&token).row, 9);
+    EXPECT_EQ(token_position(&token).column, 5);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
-    EXPECT_EQ(token.row, 9);
-    EXPECT_EQ(token.column, 6);
+    EXPECT_EQ(token_position(&token).row, 9);
+    EXPECT_EQ(token_position(&token).column, 6);
 }
 
 TEST_F(ScannerInput, ComplexProgram2)
@@ -557,16 +541,14 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "ifj21"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ifj21"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_FUNCTION);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -579,8 +561,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -594,8 +575,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "vysl"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "vysl"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -613,32 +593,28 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Zadejte cislo pro vypocet faktorialu\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Zadejte cislo pro vypocet faktorialu\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "readi"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "readi"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -651,8 +627,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_DOUBLE_EQUALS);
@@ -665,16 +640,14 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "a je nil\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a je nil\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
@@ -693,8 +666,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LT);
@@ -708,16 +680,14 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Faktorial nelze spocitat\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Faktorial nelze spocitat\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
@@ -727,8 +697,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "vysl"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "vysl"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
@@ -742,8 +711,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_GT);
@@ -757,37 +725,32 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "vysl"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "vysl"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "vysl"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "vysl"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_ASTERISK);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_MINUS);
@@ -801,32 +764,28 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Vysledek je: "), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Vysledek je: "), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "vysl"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "vysl"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
@@ -839,8 +798,7 @@ TEST_F(ScannerInput, ComplexProgram2)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -862,16 +820,14 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "ifj21"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "ifj21"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_FUNCTION);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -884,8 +840,7 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -899,16 +854,14 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Toto je nejaky text"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Toto je nejaky text"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LOCAL);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s2"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s2"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -922,45 +875,39 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_DOUBLE_DOT);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, ", ktery jeste trochu obohatime"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, ", ktery jeste trochu obohatime"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "a"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "a"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s2"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s2"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
@@ -970,8 +917,7 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -988,16 +934,14 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LOCAL);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len4"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len4"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COLON);
@@ -1011,21 +955,18 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_MINUS);
@@ -1036,56 +977,49 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "substr"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "substr"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s2"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s2"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len4"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len4"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_PLUS);
@@ -1096,113 +1030,100 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "4 znaky od"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "4 znaky od"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1len"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1len"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, ". znaku v \""), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, ". znaku v \""), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s2"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s2"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "\":"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "\":"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Zadejte serazenou posloupnost vsech malych pismen a-h, "),
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Zadejte serazenou posloupnost vsech malych pismen a-h, "),
               0);
-    str_free(&token.string);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "pricemz se pismena nesmeji v posloupnosti opakovat: "), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "pricemz se pismena nesmeji v posloupnosti opakovat: "),
+              0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "reads"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "reads"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -1215,8 +1136,7 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TILDE_EQUALS);
@@ -1232,56 +1152,49 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_TILDE_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "abcdefgh"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "abcdefgh"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_DO);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "write"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "write"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "\n"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "\n"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_COMMA);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_STRING);
-    EXPECT_EQ(strcmp(token.string.ptr, "Spatne zadana posloupnost, zkuste znovu:"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "Spatne zadana posloupnost, zkuste znovu:"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_RPAREN);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "s1"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "s1"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_EQUALS);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "reads"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "reads"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -1303,8 +1216,7 @@ TEST_F(ScannerInput, ComplexProgram3)
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_IDENTIFIER);
-    EXPECT_EQ(strcmp(token.string.ptr, "main"), 0);
-    str_free(&token.string);
+    EXPECT_EQ(str_view_cmp(token.lexeme, "main"), 0);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.token_type, T_LPAREN);
@@ -1356,7 +1268,12 @@ TEST_F(ScannerInput, UngetToken)
 
     ASSERT_EQ(unget_token(), 0);
 
-    ASSERT_EQ(unget_token(), 1);
+    // any number of tokens can be returned
+    ASSERT_EQ(unget_token(), 0);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.number, (double) 3.14);
+    EXPECT_EQ(token.token_type, T_NUMBER);
 
     ASSERT_EQ(get_next_token(&token), E_OK);
     EXPECT_EQ(token.number, (double) 3.1);
@@ -1366,3 +1283,1144 @@ TEST_F(ScannerInput, UngetToken)
     EXPECT_EQ(token.number, (double) 3123.0000001);
     EXPECT_EQ(token.token_type, T_NUMBER);
 }
+
+TEST_F(ScannerInput, UngetBeforeFirstToken)
+{
+    UseFile("tests/scanner_test_files/numbers.tl");
+    token_t token;
+
+    ASSERT_EQ(unget_token(), E_LEX);
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    ASSERT_EQ(unget_token(), E_OK);
+    ASSERT_EQ(unget_token(), E_LEX);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.integer, (int64_t) 123);
+}
+
+TEST_F(ScannerInput, PeekToken)
+{
+    UseFile("tests/scanner_test_files/numbers.tl");
+    token_t token;
+
+    ASSERT_EQ(peek_token(2, &token), E_OK);
+    EXPECT_EQ(token.number, (double) 3.1);
+    ASSERT_EQ(peek_token(0, &token), E_OK);
+    EXPECT_EQ(token.integer, (int64_t) 123);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.integer, (int64_t) 123);
+    ASSERT_EQ(peek_token(1, &token), E_OK);
+    EXPECT_EQ(token.number, (double) 3.1);
+
+    // past the end the last token repeats
+    ASSERT_EQ(peek_token(1000, &token), E_OK);
+    EXPECT_EQ(token.token_type, T_EOF);
+}
+
+/**
+ * Scanner reading from a temporary file filled with source.
+ */
+static void scan_string(const std::string &source)
+{
+    FILE *f = tmpfile();
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(source.data(), 1, source.size(), f), source.size());
+    rewind(f);
+    ASSERT_EQ(scanner_init(f), E_OK);
+}
+
+TEST(ScannerInit, UnreadableSource)
+{
+    token_t token;
+    EXPECT_EQ(scanner_init(NULL), E_INT);
+    EXPECT_EQ(get_next_token(&token), E_INT);
+    EXPECT_EQ(scanner_free(), E_OK);
+
+    // directories open fine but can't be read
+    FILE *f = fopen("tests", "r");
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(scanner_init(f), E_INT);
+    EXPECT_EQ(get_next_token(&token), E_INT);
+    EXPECT_EQ(scanner_free(), E_OK);
+}
+
+TEST_F(ScannerInput, LongRunsKeepPositions)
+{
+    std::string indent(100, ' ');
+    std::string words(70, 'w');
+    std::string source = indent + "a\n" +                       // row 1
+                         "\t\v\f\r" + indent + "b -- " + words + // row 2
+                         "\n--[[" + words + "\n" + words + "]]" + // rows 3, 4
+                         "c \"" + words + "\\n" + words + "\n" + words + "\" d";
+
+    scan_string(source);
+    token_t token;
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(token_position(&token).row, 1);
+    EXPECT_EQ(token_position(&token).column, 101);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(token_position(&token).row, 2);
+    EXPECT_EQ(token_position(&token).column, 105);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 73);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_STRING);
+    EXPECT_EQ(token_position(&token).row, 4);
+    EXPECT_EQ(token_position(&token).column, 75);
+    EXPECT_EQ(std::string(token.lexeme.ptr, token.lexeme.length),
+              words + "\n" + words + "\n" + words);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token_position(&token).column, 73);
+
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_EOF);
+}
+
+TEST_F(ScannerInput, PositionsFromOffsets)
+{
+    // newlines in comments and strings count as well
+    scan_string("x -- c\ny\n\n  \"a\nb\" z");
+    token_t token;
+    size_t rows[] = { 1, 2, 4, 5, 5 };
+    size_t columns[] = { 1, 1, 3, 4, 5 };
+
+    for(int i = 0; i < 5; i++) {
+        ASSERT_EQ(get_next_token(&token), E_OK);
+        source_position_t position = token_position(&token);
+        EXPECT_EQ(position.row, rows[i]) << "token " << i;
+        EXPECT_EQ(position.column, columns[i]) << "token " << i;
+    }
+    EXPECT_EQ(token.token_type, T_EOF);
+
+    // positions can be asked for in any order once the index exists
+    ASSERT_EQ(unget_token(), E_OK);
+    ASSERT_EQ(unget_token(), E_OK);
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(token_position(&token).row, 5);
+    EXPECT_EQ(token.offset, 18);
+}
+
+TEST(ScannerSkip, MatchesScalar)
+{
+    // every kind of char the skip routines care about, plus a high byte
+    static const char alphabet[] = " \t\v\f\r\n]\"\\ax\xe9";
+    char buffer[256];
+    unsigned seed = 1;
+    for(size_t i = 0; i < sizeof(buffer); i++) {
+        seed = seed * 1103515245 + 12345;
+        // mostly spaces or letters so that runs span several vectors
+        int r = (seed >> 16) % 64;
+        buffer[i] = r < 48 ? (r < 24 ? ' ' : 'x') : alphabet[r % (sizeof(alphabet) - 1)];
+    }
+
+    for(size_t begin = 0; begin < 48; begin++) {
+        for(size_t end = begin; end < sizeof(buffer); end++) {
+            const char *p = buffer + begin;
+            const char *e = buffer + end;
+
+            const char *spaces = p;
+            while(spaces < e && strchr(" \t\n\v\f\r", *spaces) && *spaces) {
+                spaces++;
+            }
+            ASSERT_EQ(skip_spaces(p, e), spaces) << begin << ".." << end;
+
+            const char *stop = p;
+            while(stop < e && *stop != '\n' && *stop != '"' && *stop != '\\') {
+                stop++;
+            }
+            ASSERT_EQ(skip_to_any(p, e, '\n', '"', '\\'), stop) << begin << ".." << end;
+        }
+    }
+}
+
+/**
+ * Reads all tokens, the lexical error if any ends the list.
+ */
+static std::vector<token_t> read_all(int *result)
+{
+    std::vector<token_t> tokens;
+    token_t token;
+    do {
+        *result = get_next_token(&token);
+        tokens.push_back(token);
+    } while(*result == E_OK && token.token_type != T_EOF);
+    return tokens;
+}
+
+/**
+ * Scans source at once and through the pipeline, both have to give the same tokens.
+ */
+static void check_pipeline(const std::string &source, int expected_result)
+{
+    int result;
+    scan_string(source);
+    ASSERT_EQ(scanner_tokenize(), expected_result);
+    std::vector<token_t> expected = read_all(&result);
+    ASSERT_EQ(result, expected_result);
+    scanner_free();
+
+    scan_string(source);
+    ASSERT_EQ(scanner_pipeline(), E_OK);
+    std::vector<token_t> tokens = read_all(&result);
+    EXPECT_EQ(result, expected_result);
+    scanner_free();
+
+    ASSERT_EQ(tokens.size(), expected.size());
+    for(size_t i = 0; i < tokens.size(); i++) {
+        // only the position of a lexical error is defined
+        if(i + 1 < tokens.size() || result == E_OK) {
+            ASSERT_EQ(tokens[i].token_type, expected[i].token_type) << "token " << i;
+        }
+        ASSERT_EQ(tokens[i].offset, expected[i].offset) << "token " << i;
+    }
+}
+
+TEST(ScannerPipeline, MatchesTokenize)
+{
+    std::string source;
+    for(int i = 0; i < 5000; i++) {
+        source += "local x" + std::to_string(i) + " : number = " + std::to_string(i) + ".5 -- c\n";
+    }
+    check_pipeline(source, E_OK);
+}
+
+TEST(ScannerPipeline, LexErrorMidStream)
+{
+    std::string source;
+    for(int i = 0; i < 5000; i++) {
+        source += "write(\"line\", " + std::to_string(i) + ")\n";
+    }
+    check_pipeline(source + "local $ = 1\n" + source, E_LEX);
+}
+
+TEST(ScannerPipeline, StopEarly)
+{
+    // lexer thread blocks on a full ring, scanner_free() has to stop it
+    std::string source;
+    while(source.size() < (1 << 20)) {
+        source += "a = b + c * 3\n";
+    }
+    scan_string(source);
+    ASSERT_EQ(scanner_pipeline(), E_OK);
+
+    token_t token;
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_IDENTIFIER);
+    EXPECT_EQ(scanner_free(), E_OK);
+}
+
+// size of generated benchmark input
+#define BENCH_SOURCE_LENGTH (8 << 20)
+
+/**
+ * Input of the reference scanner: the source buffer, lexemes are views into it.
+ */
+class buffer_input {
+  public:
+    buffer_input(const char *data, size_t length) : cursor(data), end(data + length), start(data)
+    {
+    }
+
+    int get()
+    {
+        return cursor < end ? (unsigned char) *cursor++ : EOF;
+    }
+
+    void unget(int c)
+    {
+        if(c != EOF) {
+            cursor--;
+        }
+    }
+
+    /// starts a lexeme, with the char read last or after it
+    void mark(bool with_last)
+    {
+        start = cursor - with_last;
+    }
+
+    /// chars read since mark(), except the last drop ones
+    str_view_t lexeme(size_t drop) const
+    {
+        return { start, (size_t)(cursor - start) - drop };
+    }
+
+  private:
+    const char *cursor, *end, *start;
+};
+
+/**
+ * Input of the reference scanner: a stream read char by char through fgetc(), as the scanner did
+ * before it loaded the source into one buffer. Lexemes are copied as they are read.
+ */
+class fgetc_input {
+  public:
+    explicit fgetc_input(FILE *f) : f(f)
+    {
+    }
+
+    int get()
+    {
+        int c = fgetc(f);
+        if(c != EOF) {
+            chars.push_back(c);
+        }
+        return c;
+    }
+
+    void unget(int c)
+    {
+        if(c != EOF) {
+            chars.pop_back();
+            ungetc(c, f);
+        }
+    }
+
+    void mark(bool with_last)
+    {
+        chars.erase(0, chars.size() - (with_last && !chars.empty()));
+    }
+
+    str_view_t lexeme(size_t drop) const
+    {
+        return { chars.data(), chars.size() - drop };
+    }
+
+  private:
+    FILE *f;
+    std::string chars; ///< chars read since mark()
+};
+
+/**
+ * The switch driven scanner that scanner-table.h replaced, kept as a reference.
+ *
+ * Every state is a case of a switch and every char goes through an if chain of its state. Numbers
+ * are parsed by scanner-number.h and string literals with escape sequences are kept until the end
+ * like in the table scanner, so the two differ only in dispatch. Lexemes of fgetc_input are valid
+ * until the next token.
+ */
+template <class Input> class switch_scanner {
+  public:
+    explicit switch_scanner(Input input) : in(input), escaped()
+    {
+    }
+
+    ~switch_scanner()
+    {
+        str_free(&escaped);
+        for(char *ptr : materialized) {
+            free(ptr);
+        }
+    }
+
+    int next(token_t *t)
+    {
+        enum {
+            START,
+            IDENTIFIER,
+            NUMBER,
+            DECIMAL,
+            EXPONENT,
+            EXPONENT_VALUE,
+            DOT,
+            LESS_THAN,
+            GREATER_THAN,
+            EQUALS,
+            TILDE,
+            SLASH,
+            DASH,
+            COMMENT_START,
+            COMMENT_BRACKET,
+            INLINE_COMMENT,
+            BLOCK_COMMENT,
+            CLOSING_BRACKET,
+            STRING,
+            ESCAPE,
+            ESCAPE_DIGIT_1,
+            ESCAPE_DIGIT_2,
+        } state = START;
+        char digits[3] = { 0 };
+
+        // left over by an error in the previous string literal
+        str_free(&escaped);
+        escaped = string_t();
+        while(true) {
+            int c = in.get();
+            switch(state) {
+            case START:
+                in.mark(true);
+                if(isspace(c)) {
+                    // whitespace between tokens
+                } else if(isalpha(c) || c == '_') {
+                    state = IDENTIFIER;
+                } else if(isdigit(c)) {
+                    state = NUMBER;
+                } else if(c == '"') {
+                    in.mark(false);
+                    state = STRING;
+                } else if(c == '-') {
+                    state = DASH;
+                } else if(c == '.') {
+                    state = DOT;
+                } else if(c == '<') {
+                    state = LESS_THAN;
+                } else if(c == '>') {
+                    state = GREATER_THAN;
+                } else if(c == '=') {
+                    state = EQUALS;
+                } else if(c == '~') {
+                    state = TILDE;
+                } else if(c == '/') {
+                    state = SLASH;
+                } else if(c == '+') {
+                    return emit(t, T_PLUS);
+                } else if(c == '*') {
+                    return emit(t, T_ASTERISK);
+                } else if(c == '%') {
+                    return emit(t, T_PERCENT);
+                } else if(c == '^') {
+                    return emit(t, T_CARET);
+                } else if(c == '#') {
+                    return emit(t, T_HASH);
+                } else if(c == '(') {
+                    return emit(t, T_LPAREN);
+                } else if(c == ')') {
+                    return emit(t, T_RPAREN);
+                } else if(c == ':') {
+                    return emit(t, T_COLON);
+                } else if(c == ',') {
+                    return emit(t, T_COMMA);
+                } else if(c == EOF) {
+                    return emit(t, T_EOF);
+                } else {
+                    return E_LEX;
+                }
+                break;
+
+            case IDENTIFIER:
+                if(!(isalnum(c) || c == '_')) {
+                    in.unget(c);
+                    return identifier(t, in.lexeme(0));
+                }
+                break;
+
+            case NUMBER:
+            case DECIMAL:
+                if(isdigit(c)) {
+                    // more digits of the same part
+                } else if(c == '.' && state == NUMBER) {
+                    state = DECIMAL;
+                } else if(c == 'e' || c == 'E') {
+                    state = EXPONENT;
+                } else {
+                    in.unget(c);
+                    str_view_t lexeme = in.lexeme(0);
+                    const char *end = lexeme.ptr + lexeme.length;
+                    if(state == NUMBER && !parse_integer(lexeme.ptr, end, &t->integer)) {
+                        return emit(t, T_INTEGER);
+                    }
+                    return parse_decimal(lexeme.ptr, end, &t->number) ? E_INT : emit(t, T_NUMBER);
+                }
+                break;
+
+            case EXPONENT:
+                if(c == '+' || c == '-' || isdigit(c)) {
+                    state = EXPONENT_VALUE;
+                } else {
+                    return E_LEX;
+                }
+                break;
+
+            case EXPONENT_VALUE:
+                if(!isdigit(c)) {
+                    in.unget(c);
+                    str_view_t lexeme = in.lexeme(0);
+                    return parse_decimal(lexeme.ptr, lexeme.ptr + lexeme.length, &t->number)
+                               ? E_INT
+                               : emit(t, T_NUMBER);
+                }
+                break;
+
+            case DOT:
+                return c == '.' ? emit(t, T_DOUBLE_DOT) : E_LEX;
+
+            case LESS_THAN:
+                return either(t, c, '=', T_LTE, T_LT);
+
+            case GREATER_THAN:
+                return either(t, c, '=', T_GTE, T_GT);
+
+            case EQUALS:
+                return either(t, c, '=', T_DOUBLE_EQUALS, T_EQUALS);
+
+            case SLASH:
+                return either(t, c, '/', T_DOUBLE_SLASH, T_SLASH);
+
+            case TILDE:
+                return c == '=' ? emit(t, T_TILDE_EQUALS) : E_LEX;
+
+            case DASH:
+                if(c != '-') {
+                    in.unget(c);
+                    return emit(t, T_MINUS);
+                }
+                state = COMMENT_START;
+                break;
+
+            case COMMENT_START:
+                state = c == '[' ? COMMENT_BRACKET : INLINE_COMMENT;
+                break;
+
+            case COMMENT_BRACKET:
+                state = c == '[' ? BLOCK_COMMENT : INLINE_COMMENT;
+                break;
+
+            case INLINE_COMMENT:
+                if(c == '\n') {
+                    state = START;
+                } else if(c == EOF) {
+                    return E_LEX;
+                }
+                break;
+
+            case BLOCK_COMMENT:
+                if(c == ']') {
+                    state = CLOSING_BRACKET;
+                } else if(c == EOF) {
+                    return E_LEX;
+                }
+                break;
+
+            case CLOSING_BRACKET:
+                if(c == ']') {
+                    state = START;
+                } else if(c == EOF) {
+                    return E_LEX;
+                }
+                break;
+
+            case STRING:
+                if(c == '"') {
+                    t->lexeme = in.lexeme(1);
+                    if(escaped.ptr) {
+                        t->lexeme.length = escaped.length;
+                        t->lexeme.ptr = str_detach(&escaped);
+                        if(!t->lexeme.ptr) {
+                            return E_INT;
+                        }
+                        materialized.push_back((char *) t->lexeme.ptr);
+                    }
+                    return emit(t, T_STRING);
+                } else if(c == '\\') {
+                    // first escape sequence, copy what was read so far
+                    if(!escaped.ptr && str_create_view(in.lexeme(1), &escaped)) {
+                        return E_INT;
+                    }
+                    state = ESCAPE;
+                } else if(c == EOF) {
+                    return E_LEX;
+                } else if(escaped.ptr && str_append_char(&escaped, c)) {
+                    return E_INT;
+                }
+                break;
+
+            case ESCAPE:
+                if(isdigit(c)) {
+                    digits[0] = c;
+                    state = ESCAPE_DIGIT_1;
+                } else if(c == 'n' || c == 't' || c == '\\' || c == '"') {
+                    if(str_append_char(&escaped, c == 'n' ? '\n' : c == 't' ? '\t' : c)) {
+                        return E_INT;
+                    }
+                    state = STRING;
+                } else {
+                    return E_LEX;
+                }
+                break;
+
+            case ESCAPE_DIGIT_1:
+                if(!isdigit(c)) {
+                    return E_LEX;
+                }
+                digits[1] = c;
+                state = ESCAPE_DIGIT_2;
+                break;
+
+            case ESCAPE_DIGIT_2: {
+                // other chars are skipped, as they always were
+                if(c == EOF) {
+                    return E_LEX;
+                } else if(!isdigit(c)) {
+                    break;
+                }
+                digits[2] = c;
+                int value = (digits[0] - '0') * 100 + (digits[1] - '0') * 10 + (digits[2] - '0');
+                if(value < 1 || value > 255) {
+                    return E_LEX;
+                }
+                if(str_append_char(&escaped, value)) {
+                    return E_INT;
+                }
+                state = STRING;
+                break;
+            }
+            }
+        }
+    }
+
+  private:
+    Input in;
+    string_t escaped;                ///< string literal with processed escape sequences
+    std::vector<char *> materialized; ///< string literals with escape sequences read so far
+
+    static int emit(token_t *t, term_type_t type)
+    {
+        t->token_type = type;
+        return E_OK;
+    }
+
+    /// token of two chars if c is second, otherwise the one char token
+    int either(token_t *t, int c, char second, term_type_t two, term_type_t one)
+    {
+        if(c == second) {
+            return emit(t, two);
+        }
+        in.unget(c);
+        return emit(t, one);
+    }
+
+    static int identifier(token_t *t, str_view_t lexeme)
+    {
+        const keyword_t *keyword = keyword_lookup(lexeme.ptr, lexeme.length);
+        if(!keyword) {
+            t->lexeme = lexeme;
+            return emit(t, T_IDENTIFIER);
+        }
+        if(keyword->token_type == T_TYPE) {
+            t->type = (type_t) keyword->value;
+        } else if(keyword->token_type == T_BOOL) {
+            t->boolean = keyword->value;
+        }
+        return emit(t, keyword->token_type);
+    }
+};
+
+static const char bench_snippet[] =
+    "-- benchmark input\n"
+    "function fact(n : integer) : integer\n"
+    "    local result : integer = 1\n"
+    "    while n > 1 do\n"
+    "        result = result * n\n"
+    "        n = n - 1\n"
+    "    end\n"
+    "    return result\n"
+    "end\n"
+    "--[[ block\n"
+    "     comment ]]\n"
+    "local s : string = \"hello\\tworld\\n\" .. \"x\" -- trailing comment\n"
+    "local pi : number = 3.14159e+0\n"
+    "write(fact(10), s, #s, pi // 2, 7 % 3, 1 ~= 2, a <= b, c >= d)\n";
+
+/**
+ * Builds a multi-megabyte program by repeating bench_snippet.
+ */
+static std::string bench_source()
+{
+    std::string source;
+    source.reserve(BENCH_SOURCE_LENGTH + sizeof(bench_snippet));
+    while(source.size() < BENCH_SOURCE_LENGTH) {
+        source += bench_snippet;
+    }
+    return source;
+}
+
+/**
+ * Runs scan, which returns the number of tokens, and prints its throughput.
+ */
+template <class Scan> static size_t bench_tokens(const std::string &name, size_t length, Scan scan)
+{
+    auto start = std::chrono::steady_clock::now();
+    size_t count = scan();
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[ BENCH    ] " << name << ": " << count << " tokens, "
+              << (size_t)(count / seconds) << " tokens/s, "
+              << (size_t)(length / seconds / (1 << 20)) << " MiB/s" << std::endl;
+    return count;
+}
+
+/**
+ * Scans the whole file by the table scanner, the file is closed afterwards.
+ */
+static size_t scan_table(FILE *f)
+{
+    EXPECT_EQ(scanner_init(f), E_OK);
+
+    token_t token;
+    size_t count = 0;
+    do {
+        if(get_next_token(&token) != E_OK) {
+            ADD_FAILURE() << "scanning failed after " << count << " tokens";
+            break;
+        }
+        count++;
+    } while(token.token_type != T_EOF);
+
+    scanner_free();
+    return count;
+}
+
+/**
+ * Scans the whole input by the reference scanner, tokens are kept in an array like the table
+ * scanner keeps them for lookahead.
+ */
+template <class Input> static size_t scan_switch(Input input)
+{
+    switch_scanner<Input> scanner(input);
+    std::vector<token_t> tokens;
+    token_t token;
+    do {
+        if(scanner.next(&token) != E_OK) {
+            ADD_FAILURE() << "scanning failed after " << tokens.size() << " tokens";
+            break;
+        }
+        tokens.push_back(token);
+    } while(token.token_type != T_EOF);
+    return tokens.size();
+}
+
+/**
+ * Scans the whole file by the reference scanner reading char by char, the file is closed
+ * afterwards.
+ */
+static size_t scan_switch_fgetc(FILE *f)
+{
+    size_t count = scan_switch(fgetc_input(f));
+    fclose(f);
+    return count;
+}
+
+/**
+ * Loads the file by source_open() and scans the buffer by the reference scanner, the file is
+ * closed afterwards.
+ */
+static size_t scan_switch_buffer(FILE *f)
+{
+    source_t source;
+    EXPECT_EQ(source_open(&source, f), E_OK);
+    size_t count = scan_switch(buffer_input(source.data, source.length));
+    source_close(&source);
+    fclose(f);
+    return count;
+}
+
+/**
+ * Regular file holding source, positioned at its start.
+ */
+static FILE *bench_file(const std::string &source)
+{
+    FILE *f = tmpfile();
+    EXPECT_NE(f, nullptr);
+    EXPECT_EQ(fwrite(source.data(), 1, source.size(), f), source.size());
+    rewind(f);
+    return f;
+}
+
+/**
+ * Read end of a pipe which writer fills with source.
+ */
+static FILE *bench_pipe(const std::string &source, std::thread &writer)
+{
+    int fds[2];
+    EXPECT_EQ(pipe(fds), 0);
+    writer = std::thread([&source, fds]() {
+        size_t written = 0;
+        while(written < source.size()) {
+            ssize_t n = write(fds[1], source.data() + written, source.size() - written);
+            if(n <= 0) {
+                break;
+            }
+            written += n;
+        }
+        close(fds[1]);
+    });
+    return fdopen(fds[0], "r");
+}
+
+/**
+ * Scans inputs made by open on the old and the new path, all have to give the same tokens.
+ *
+ * The old path reads char by char through fgetc() and dispatches by switch. The new one loads the
+ * source by source_open() and dispatches by table, the reference scanner over the loaded buffer
+ * is in between and separates the two changes.
+ */
+template <class Open> static void bench_paths(const std::string &input, size_t length, Open open)
+{
+    FILE *f = open();
+    size_t tokens = bench_tokens(input + ", fgetc + switch", length,
+                                 [f]() { return scan_switch_fgetc(f); });
+    f = open();
+    EXPECT_EQ(bench_tokens(input + ", buffer + switch", length,
+                           [f]() { return scan_switch_buffer(f); }),
+              tokens);
+    f = open();
+    EXPECT_EQ(bench_tokens(input + ", buffer + table", length, [f]() { return scan_table(f); }),
+              tokens);
+}
+
+TEST(ScannerBenchmark, DISABLED_TokensPerSecond)
+{
+    std::string source = bench_source();
+
+    // regular file, mapped into memory
+    bench_paths("regular file", source.size(), [&source]() { return bench_file(source); });
+
+    // pipe, read in blocks
+    std::vector<std::thread> writers(3);
+    size_t next_writer = 0;
+    bench_paths("pipe", source.size(),
+                [&]() { return bench_pipe(source, writers[next_writer++]); });
+    for(std::thread &writer : writers) {
+        writer.join();
+    }
+}
+
+/// single kind of token repeated, see DISABLED_TokenKinds
+static const struct {
+    const char *name;
+    const char *snippet;
+} token_kinds[] = {
+    { "identifiers", "local result integer value_1 while fact end _tmp then elseif\n" },
+    { "numbers", "1 42 3.14159 1e10 2.5E-3 1234567890 0.000001 7e+2\n" },
+    { "operators", "+ - * / // % ^ # .. == ~= <= >= < > = ( ) : ,\n" },
+    { "comments", "-- inline comment with some words in it\n--[[ block\n comment ]] x\n" },
+    { "strings", "\"plain string literal\" \"escaped\\tstring\\n\" \"\\065\\066\"\n" },
+};
+
+/**
+ * Scans source by the table scanner and by the reference scanner over input, tokens have to match.
+ */
+template <class Input> static void check_reference(const std::string &source, Input input)
+{
+    switch_scanner<Input> reference(input);
+    scan_string(source);
+    token_t expected, token;
+    do {
+        ASSERT_EQ(get_next_token(&expected), E_OK);
+        ASSERT_EQ(reference.next(&token), E_OK);
+        ASSERT_EQ(token.token_type, expected.token_type);
+        switch(token.token_type) {
+        case T_IDENTIFIER:
+        case T_STRING:
+            EXPECT_EQ(std::string(token.lexeme.ptr, token.lexeme.length),
+                      std::string(expected.lexeme.ptr, expected.lexeme.length));
+            break;
+        case T_INTEGER:
+            EXPECT_EQ(token.integer, expected.integer);
+            break;
+        case T_NUMBER:
+            EXPECT_EQ(token.number, expected.number);
+            break;
+        case T_TYPE:
+            EXPECT_EQ(token.type, expected.type);
+            break;
+        case T_BOOL:
+            EXPECT_EQ(token.boolean, expected.boolean);
+            break;
+        default:
+            break;
+        }
+    } while(token.token_type != T_EOF);
+    scanner_free();
+}
+
+TEST(ScannerReference, MatchesTableScanner)
+{
+    std::string source = bench_snippet;
+    for(const auto &kind : token_kinds) {
+        source += kind.snippet;
+    }
+    source += "x = 99999999999999999999 .. a--\nb\nc--[x\nd//e/f\"\"\"\\\\\\\"\" g --[[a]x] h\n"
+              "\"two\nlines\" true false nil";
+    check_reference(source, buffer_input(source.data(), source.size()));
+
+    FILE *f = bench_file(source);
+    check_reference(source, fgetc_input(f));
+    fclose(f);
+}
+
+/**
+ * Scans bench_snippet-sized repetitions of a single kind of token by the reference switch scanner
+ * and by the table scanner, the DFA cost per byte differs mostly by how many states a lexeme
+ * passes through.
+ */
+TEST(ScannerBenchmark, DISABLED_TokenKinds)
+{
+    for(const auto &kind : token_kinds) {
+        std::string source;
+        source.reserve(BENCH_SOURCE_LENGTH + strlen(kind.snippet));
+        while(source.size() < BENCH_SOURCE_LENGTH) {
+            source += kind.snippet;
+        }
+
+        FILE *f = bench_file(source);
+        size_t tokens = bench_tokens(std::string(kind.name) + ", switch", source.size(),
+                                     [f]() { return scan_switch_buffer(f); });
+        f = bench_file(source);
+        EXPECT_EQ(bench_tokens(std::string(kind.name) + ", table", source.size(),
+                               [f]() { return scan_table(f); }),
+                  tokens);
+    }
+}
+
+/**
+ * The strcmp chain identify_keyword() used before keyword_lookup(), kept as a reference.
+ */
+static term_type_t strcmp_keyword(const char *s)
+{
+    static const struct {
+        const char *name;
+        term_type_t token_type;
+    } chain[] = {
+        { "if", T_IF },
+        { "else", T_ELSE },
+        { "do", T_DO },
+        { "end", T_END },
+        { "function", T_FUNCTION },
+        { "global", T_GLOBAL },
+        { "nil", T_NIL },
+        { "require", T_REQUIRE },
+        { "return", T_RETURN },
+        { "while", T_WHILE },
+        { "then", T_THEN },
+        { "integer", T_TYPE },
+        { "number", T_TYPE },
+        { "local", T_LOCAL },
+        { "string", T_TYPE },
+        { "boolean", T_TYPE },
+        { "true", T_BOOL },
+        { "false", T_BOOL },
+        { "elseif", T_ELSEIF },
+        { "repeat", T_REPEAT },
+        { "until", T_UNTIL },
+        { "break", T_BREAK },
+        { "not", T_NOT },
+        { "and", T_AND },
+        { "or", T_OR },
+        { "for", T_FOR },
+    };
+    for(size_t i = 0; i < sizeof(chain) / sizeof(*chain); i++) {
+        if(!strcmp(s, chain[i].name)) {
+            return chain[i].token_type;
+        }
+    }
+    return T_IDENTIFIER;
+}
+
+static term_type_t hash_keyword(const char *s, size_t length)
+{
+    const keyword_t *keyword = keyword_lookup(s, length);
+    return keyword ? keyword->token_type : T_IDENTIFIER;
+}
+
+static const char *keyword_bench_words[] = { "local", "result", "integer", "n", "while", "do",
+                                             "fact", "end", "return", "write", "s", "string", "if",
+                                             "then", "else", "x", "i", "for", "readi", "substr",
+                                             "number", "value", "tmp", "elseif", "nil", "until",
+                                             "function", "global", "ends", "iff", "_", "or_",
+                                             "notes", "a", "b", "true" };
+
+TEST(KeywordLookup, MatchesStrcmpChain)
+{
+    const char *words[] = { "if", "else", "do", "end", "function", "global", "nil", "require",
+                            "return", "while", "then", "integer", "number", "local", "string",
+                            "boolean", "true", "false", "elseif", "repeat", "until", "break", "not",
+                            "and", "or", "for", "iff", "en", "ends", "i", "_", "Integer", "fals",
+                            "nill", "forr", "functions", "x1" };
+    for(const char *word : words) {
+        EXPECT_EQ(hash_keyword(word, strlen(word)), strcmp_keyword(word)) << word;
+    }
+
+    const keyword_t *keyword = keyword_lookup("number", 6);
+    ASSERT_NE(keyword, nullptr);
+    EXPECT_EQ(keyword->value, TYPE_NUMBER);
+    keyword = keyword_lookup("false", 5);
+    ASSERT_NE(keyword, nullptr);
+    EXPECT_EQ(keyword->value, false);
+
+    // only the lexeme is compared, not what follows it in the source
+    EXPECT_EQ(hash_keyword("endless", 3), T_END);
+}
+
+TEST(KeywordLookup, DISABLED_Benchmark)
+{
+    const size_t n_words = sizeof(keyword_bench_words) / sizeof(*keyword_bench_words);
+    const size_t rounds = 100000;
+    size_t lengths[n_words];
+    for(size_t i = 0; i < n_words; i++) {
+        lengths[i] = strlen(keyword_bench_words[i]);
+    }
+
+    volatile size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < n_words; i++) {
+            sink = sink + strcmp_keyword(keyword_bench_words[i]);
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for(size_t r = 0; r < rounds; r++) {
+        for(size_t i = 0; i < n_words; i++) {
+            sink = sink + hash_keyword(keyword_bench_words[i], lengths[i]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double chain_ns = std::chrono::duration<double, std::nano>(middle - start).count();
+    double hash_ns = std::chrono::duration<double, std::nano>(end - middle).count();
+    std::cout << "[ BENCH    ] strcmp chain: " << chain_ns / (rounds * n_words)
+              << " ns/lookup, perfect hash: " << hash_ns / (rounds * n_words) << " ns/lookup"
+              << std::endl;
+}
+
+/**
+ * Parses lexeme with both parse_decimal() and strtod(), the doubles have to have the same bits.
+ */
+static void check_decimal(const std::string &lexeme)
+{
+    double parsed, expected = strtod(lexeme.c_str(), NULL);
+    ASSERT_EQ(parse_decimal(lexeme.data(), lexeme.data() + lexeme.size(), &parsed), 0) << lexeme;
+    ASSERT_EQ(memcmp(&parsed, &expected, sizeof(double)), 0)
+        << lexeme << ": " << parsed << " != " << expected;
+}
+
+/**
+ * Generates a random literal the scanner accepts as a number.
+ */
+static std::string random_decimal(std::mt19937_64 &rng)
+{
+    std::string lexeme;
+    int int_digits = 1 + rng() % 22;
+    for(int i = 0; i < int_digits; i++) {
+        lexeme += (char) ('0' + rng() % 10);
+    }
+    if(rng() % 2) {
+        lexeme += '.';
+        int frac_digits = rng() % 22;
+        for(int i = 0; i < frac_digits; i++) {
+            lexeme += (char) ('0' + rng() % 10);
+        }
+    }
+    if(rng() % 2) {
+        lexeme += "e" + std::string(rng() % 2 ? "-" : "+") + std::to_string(rng() % 360);
+    }
+    return lexeme;
+}
+
+TEST(NumberParsing, MatchesStrtod)
+{
+    const char *edge_cases[] = {
+        "0", "0.0", "000.000e5", "1", "1.", "3.14", "42.4e-3", "0.1", "0.3", "1e22", "1e23",
+        "9007199254740993", "9007199254740992.5", "2.2250738585072014e-308",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062328e-324",
+        "2.4703282292062327e-324", "1e-400", "1.7976931348623157e308", "1.7976931348623159e308",
+        "1e309", "123456789012345678901234567890", "0.000000000000000000000000000001",
+        "7.0e-10", "1e-342", "1e-343", "1e308", "5e-324", "9999999999999999999",
+        "18446744073709551615", "18446744073709551616e-10", "1e+0", "1E5", "1e100000000000000",
+    };
+    for(const char *lexeme : edge_cases) {
+        check_decimal(lexeme);
+    }
+
+    std::mt19937_64 rng(42);
+    for(int i = 0; i < 200000; i++) {
+        check_decimal(random_decimal(rng));
+    }
+
+    double value;
+    const char *malformed[] = { "", ".5", "1e", "1e+", "1.5x", "1..5" };
+    for(const char *lexeme : malformed) {
+        EXPECT_EQ(parse_decimal(lexeme, lexeme + strlen(lexeme), &value), 1) << lexeme;
+    }
+}
+
+TEST(NumberParsing, IntegerOverflow)
+{
+    int64_t value;
+    std::string max = "9223372036854775807";
+    ASSERT_EQ(parse_integer(max.data(), max.data() + max.size(), &value), 0);
+    EXPECT_EQ(value, INT64_MAX);
+    std::string over = "9223372036854775808";
+    EXPECT_EQ(parse_integer(over.data(), over.data() + over.size(), &value), 1);
+
+    // integer literals which don't fit are read as numbers
+    scan_string(max + " " + over + " 00000000000000000000042");
+    token_t token;
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_INTEGER);
+    EXPECT_EQ(token.integer, INT64_MAX);
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_NUMBER);
+    EXPECT_EQ(token.number, 9223372036854775808.0);
+    ASSERT_EQ(get_next_token(&token), E_OK);
+    EXPECT_EQ(token.token_type, T_INTEGER);
+    EXPECT_EQ(token.integer, 42);
+    scanner_free();
+}
+
+TEST(NumberParsing, DISABLED_Benchmark)
+{
+    static const struct {
+        const char *name;
+        std::vector<std::string> lexemes;
+    } inputs[] = {
+        { "short decimals", { "3.14", "0.5", "2.25", "1.0", "42.4", "7.75", "0.1", "99.9" } },
+        { "exponents", { "42.4e-3", "1e10", "2.5E-3", "7e+2", "6.02214076e23", "1.6e-19" } },
+        { "long decimals",
+          { "3.141592653589793", "2.718281828459045", "0.30000000000000004",
+            "1.7976931348623157e308", "2.2250738585072014e-308", "123456.789012345" } },
+    };
+    const size_t rounds = 200000;
+
+    for(const auto &input : inputs) {
+        volatile double sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(size_t r = 0; r < rounds; r++) {
+            for(const auto &lexeme : input.lexemes) {
+                // copied like the scanner had to, the lexeme isn't null terminated in the source
+                char buffer[64];
+                memcpy(buffer, lexeme.data(), lexeme.size());
+                buffer[lexeme.size()] = '\0';
+                sink = sink + strtod(buffer, NULL);
+            }
+        }
+        auto middle = std::chrono::steady_clock::now();
+        for(size_t r = 0; r < rounds; r++) {
+            for(const auto &lexeme : input.lexemes) {
+                double value;
+                parse_decimal(lexeme.data(), lexeme.data() + lexeme.size(), &value);
+                sink = sink + value;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        size_t n = rounds * input.lexemes.size();
+        double strtod_ns = std::chrono::duration<double, std::nano>(middle - start).count();
+        double parse_ns = std::chrono::duration<double, std::nano>(end - middle).count();
+        std::cout << "[ BENCH    ] " << input.name << ": strtod " << strtod_ns / n
+                  << " ns/number, parse_decimal " << parse_ns / n << " ns/number" << std::endl;
+    }
+}
@@ -1,121 +1,104 @@
-#include <stdexcept>
 #include <gtest/gtest.h>
 
 extern "C" {
-#include "stack.h"
+#include "typed_stack.h"
 #include "error.h"
 }
 
+DEFINE_STACK(int_stack, int)
+
 class EmptyStack : public ::testing::Test {
 
   protected:
-    adt_stack_t stack;
+    int_stack_t stack;
 
     virtual void SetUp() override
     {
-        // throw exception if allocation failed
-        if(stack_create(&stack, 1) != E_OK) {
-            throw std::bad_alloc();
-        }
+        int_stack_create(&stack);
     }
     virtual void TearDown() override
     {
-        stack_free(&stack);
+        int_stack_free(&stack);
     }
 };
 
-TEST(StackCreation, CreateEmpty)
+TEST(StackCreation, Reserve)
 {
-    adt_stack_t stack;
-    ASSERT_EQ(stack_create(&stack, 10), E_OK);
-    stack_free(&stack);
+    int_stack_t stack;
+    int_stack_create(&stack);
+    ASSERT_EQ(int_stack_reserve(&stack, 10), E_OK);
+    EXPECT_GE(stack.capacity, 10u);
+    EXPECT_TRUE(int_stack_empty(&stack));
+    int_stack_free(&stack);
 }
 
 TEST_F(EmptyStack, CheckEmpty)
 {
     EXPECT_EQ(stack.size, 0);
-    EXPECT_EQ(stack_top(&stack), nullptr);
-    EXPECT_EQ(stack_empty(&stack), true);
+    EXPECT_EQ(int_stack_empty(&stack), true);
 }
 
 TEST_F(EmptyStack, PushOneElement)
 {
-    int data = 10;
-    EXPECT_EQ(stack_push(&stack, &data), E_OK);
+    EXPECT_EQ(int_stack_push(&stack, 10), E_OK);
     EXPECT_EQ(stack.size, 1);
 }
 
 TEST_F(EmptyStack, PushTwoElements)
 {
-    int data1 = 10, data2 = 20;
-    stack_push(&stack, &data1);
-    EXPECT_EQ(stack_push(&stack, &data2), E_OK);
+    int_stack_push(&stack, 10);
+    EXPECT_EQ(int_stack_push(&stack, 20), E_OK);
     EXPECT_EQ(stack.size, 2);
 }
 
 TEST_F(EmptyStack, PopOneElement)
 {
-    int data = 10;
-    stack_push(&stack, &data);
-    EXPECT_FALSE(stack_empty(&stack));
-    EXPECT_NE(stack_top(&stack), nullptr);
-    EXPECT_NE(stack_pop(&stack), nullptr);
-    EXPECT_TRUE(stack_empty(&stack));
-    EXPECT_EQ(stack_top(&stack), nullptr);
+    int_stack_push(&stack, 10);
+    EXPECT_FALSE(int_stack_empty(&stack));
+    EXPECT_EQ(int_stack_pop(&stack), 10);
+    EXPECT_TRUE(int_stack_empty(&stack));
 }
 
-TEST_F(EmptyStack, PopTwoElements)
+TEST_F(EmptyStack, CheckTwoElements)
 {
-    int data1 = 10, data2 = 20;
-    stack_push(&stack, &data1);
-    stack_push(&stack, &data2);
-    EXPECT_FALSE(stack_empty(&stack));
-    EXPECT_NE(stack_top(&stack), nullptr);
-    EXPECT_NE(stack_pop(&stack), nullptr);
-    EXPECT_FALSE(stack_empty(&stack));
-    EXPECT_NE(stack_top(&stack), nullptr);
-    EXPECT_NE(stack_pop(&stack), nullptr);
-    EXPECT_TRUE(stack_empty(&stack));
-    EXPECT_EQ(stack_top(&stack), nullptr);
+    int_stack_push(&stack, 10);
+    int_stack_push(&stack, 20);
+    EXPECT_EQ(*int_stack_top(&stack), 20);
+    EXPECT_EQ(int_stack_pop(&stack), 20);
+    EXPECT_FALSE(int_stack_empty(&stack));
+    EXPECT_EQ(*int_stack_top(&stack), 10);
+    EXPECT_EQ(int_stack_pop(&stack), 10);
+    EXPECT_TRUE(int_stack_empty(&stack));
 }
 
-TEST_F(EmptyStack, CheckPopFail)
+TEST_F(EmptyStack, TopIsWritable)
 {
-    EXPECT_EQ(stack_pop(&stack), nullptr);
+    int_stack_push(&stack, 10);
+    *int_stack_top(&stack) = 30;
+    EXPECT_EQ(int_stack_pop(&stack), 30);
 }
 
-TEST_F(EmptyStack, CheckOneElement)
+TEST(TypedStack, MovesOutOfBuffer)
 {
-    int data = 10;
-    stack_push(&stack, &data);
-    ASSERT_NE(stack_top(&stack), nullptr);
-    int get = *(int *) stack_top(&stack);
-    ASSERT_EQ(get, 10);
-}
+    int buffer[4];
+    int_stack_t stack;
+    int_stack_create_buffer(&stack, buffer, 4);
+    EXPECT_TRUE(int_stack_empty(&stack));
 
-TEST_F(EmptyStack, CheckPop)
-{
-    int data = 10;
-    stack_push(&stack, &data);
-    ASSERT_NE(stack_top(&stack), nullptr);
-    int get1 = *(int *) stack_pop(&stack);
-    EXPECT_EQ(get1, 10);
-    EXPECT_TRUE(stack_empty(&stack));
-    EXPECT_EQ(stack_top(&stack), nullptr);
-}
+    for(int i = 0; i < 4; i++) {
+        ASSERT_EQ(int_stack_push(&stack, i), E_OK);
+    }
+    EXPECT_EQ(stack.array, buffer);
+    for(int i = 4; i < 100; i++) {
+        ASSERT_EQ(int_stack_push(&stack, i), E_OK);
+    }
+    EXPECT_NE(stack.array, buffer);
+    EXPECT_EQ(*int_stack_top(&stack), 99);
 
-TEST_F(EmptyStack, CheckTwoElements)
-{
-    int data1 = 10, data2 = 20;
-    stack_push(&stack, &data1);
-    stack_push(&stack, &data2);
-    ASSERT_NE(stack_top(&stack), nullptr);
-    int get2 = *(int *) stack_top(&stack);
-    EXPECT_EQ(get2, 20);
-    stack_pop(&stack);
-    ASSERT_NE(stack_top(&stack), nullptr);
-    int get1 = *(int *) stack_pop(&stack);
-    EXPECT_EQ(get1, 10);
-    EXPECT_TRUE(stack_empty(&stack));
-    EXPECT_EQ(stack_top(&stack), nullptr);
+    for(int i = 99; i >= 0; i--) {
+        ASSERT_FALSE(int_stack_empty(&stack));
+        EXPECT_EQ(int_stack_pop(&stack), i);
+    }
+    EXPECT_TRUE(int_stack_empty(&stack));
+    int_stack_free(&stack);
 }
@@ -1,33 +1,30 @@
 
 #include <stdexcept>
+#include <vector>
 #include <gtest/gtest.h>
 
 extern "C" {
+#include "atom.h"
 #include "symtable.h"
 #include "error.h"
 }
 
 struct test_data_t {
-    string_t name;
+    atom_t name;
 
-    test_data_t(std::string str)
+    test_data_t(std::string str) : name(atom_intern_cstr(str.c_str()))
     {
-        if(str_create_empty(&name) != E_OK) {
+        if(!name) {
             throw std::bad_alloc();
         }
-        for(char c : str) {
-            if(str_append_char(&name, c) != E_OK) {
-                throw std::bad_alloc();
-            }
-        }
-    }
-
-    ~test_data_t()
-    {
-        str_free(&name);
     }
 };
 
+static atom_t id(const char *s)
+{
+    return atom_intern_cstr(s);
+}
+
 class EmptySymtable : public ::testing::Test {
 
   protected:
@@ -45,7 +42,7 @@ class EmptySymtable : public ::testing::Test {
 
 TEST_F(EmptySymtable, CheckEmpty)
 {
-    EXPECT_EQ(symtable_find("x"), nullptr);
+    EXPECT_EQ(symtable_find(id("x")), nullptr);
 }
 
 TEST_F(EmptySymtable, AddScope)
@@ -58,101 +55,203 @@ TEST_F(EmptySymtable, AddScope)
 TEST_F(EmptySymtable, CheckSymbol)
 {
     test_data_t data("x");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data), E_OK);
-    test_data_t *ref = (test_data_t *) symtable_find("x");
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data), E_OK);
+    test_data_t *ref = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data.name.ptr);
+    EXPECT_EQ(ref->name, data.name);
 }
 
 TEST_F(EmptySymtable, CheckTwoSymbols)
 {
     test_data_t data1("x");
     test_data_t data2("y");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data1), E_OK);
-    EXPECT_EQ(symtable_put_symbol("y", (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("y"), (ast_node_t *) &data2), E_OK);
 
-    test_data_t *ref1 = (test_data_t *) symtable_find("x");
+    test_data_t *ref1 = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref1, nullptr);
-    test_data_t *ref2 = (test_data_t *) symtable_find("y");
+    test_data_t *ref2 = (test_data_t *) symtable_find(id("y"));
     ASSERT_NE(ref2, nullptr);
-    EXPECT_EQ(ref1->name.ptr, data1.name.ptr);
-    EXPECT_EQ(ref2->name.ptr, data2.name.ptr);
+    EXPECT_EQ(ref1->name, data1.name);
+    EXPECT_EQ(ref2->name, data2.name);
 }
 
 TEST_F(EmptySymtable, CheckTwoSymbolsMultipleScopes)
 {
     test_data_t data1("x");
     test_data_t data2("y");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data1), E_OK);
 
     EXPECT_EQ(symtable_push_scope(), E_OK);
 
-    EXPECT_EQ(symtable_put_symbol("y", (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("y"), (ast_node_t *) &data2), E_OK);
 
-    test_data_t *ref1 = (test_data_t *) symtable_find("x");
+    test_data_t *ref1 = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref1, nullptr);
-    test_data_t *ref2 = (test_data_t *) symtable_find("y");
+    test_data_t *ref2 = (test_data_t *) symtable_find(id("y"));
     ASSERT_NE(ref2, nullptr);
-    EXPECT_EQ(ref1->name.ptr, data1.name.ptr);
-    EXPECT_EQ(ref2->name.ptr, data2.name.ptr);
+    EXPECT_EQ(ref1->name, data1.name);
+    EXPECT_EQ(ref2->name, data2.name);
 }
 
 TEST_F(EmptySymtable, CheckSymbolOvershadowing)
 {
     test_data_t data1("x");
     test_data_t data2("y");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data1), E_OK);
 
-    test_data_t *ref = (test_data_t *) symtable_find("x");
+    test_data_t *ref = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data1.name.ptr);
+    EXPECT_EQ(ref->name, data1.name);
 
     EXPECT_EQ(symtable_push_scope(), E_OK);
 
-    ref = (test_data_t *) symtable_find("x");
+    ref = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data1.name.ptr);
+    EXPECT_EQ(ref->name, data1.name);
 
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data2), E_OK);
 
-    ref = (test_data_t *) symtable_find("x");
+    ref = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data2.name.ptr);
+    EXPECT_EQ(ref->name, data2.name);
 }
 
 TEST_F(EmptySymtable, CheckFindCurrent)
 {
     test_data_t data1("x");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data1), E_OK);
 
     EXPECT_EQ(symtable_push_scope(), E_OK);
 
     test_data_t data2("y");
-    EXPECT_EQ(symtable_put_symbol("y", (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("y"), (ast_node_t *) &data2), E_OK);
 
-    test_data_t *ref = (test_data_t *) symtable_find_in_current("x");
+    test_data_t *ref = (test_data_t *) symtable_find_in_current(id("x"));
     EXPECT_EQ(ref, nullptr);
 
-    ref = (test_data_t *) symtable_find_in_current("y");
+    ref = (test_data_t *) symtable_find_in_current(id("y"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data2.name.ptr);
+    EXPECT_EQ(ref->name, data2.name);
 }
 
 TEST_F(EmptySymtable, CheckFindGlobal)
 {
     test_data_t data1("x#0");
-    EXPECT_EQ(symtable_put_in_global("x", (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_in_global(id("x"), (ast_node_t *) &data1), E_OK);
 
     EXPECT_EQ(symtable_push_scope(), E_OK);
 
     test_data_t data2("x#1");
-    EXPECT_EQ(symtable_put_symbol("x", (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data2), E_OK);
 
-    test_data_t *ref = (test_data_t *) symtable_find("x");
+    test_data_t *ref = (test_data_t *) symtable_find(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data2.name.ptr);
+    EXPECT_EQ(ref->name, data2.name);
 
-    ref = (test_data_t *) symtable_find_in_global("x");
+    ref = (test_data_t *) symtable_find_in_global(id("x"));
     ASSERT_NE(ref, nullptr);
-    EXPECT_EQ(ref->name.ptr, data1.name.ptr);
+    EXPECT_EQ(ref->name, data1.name);
+}
+
+TEST_F(EmptySymtable, PopRestoresShadowed)
+{
+    test_data_t data1("x#0");
+    test_data_t data2("x#1");
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data1), E_OK);
+
+    EXPECT_EQ(symtable_push_scope(), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("x"), (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("y"), (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_scope_level(), 1);
+    EXPECT_EQ(symtable_pop_scope(), E_OK);
+
+    test_data_t *ref = (test_data_t *) symtable_find(id("x"));
+    ASSERT_NE(ref, nullptr);
+    EXPECT_EQ(ref->name, data1.name);
+    EXPECT_EQ(symtable_find(id("y")), nullptr);
+    EXPECT_EQ(symtable_scope_level(), 0);
+}
+
+TEST_F(EmptySymtable, PutInGlobalFromNestedScope)
+{
+    test_data_t data1("f#0");
+    test_data_t data2("f#2");
+
+    EXPECT_EQ(symtable_push_scope(), E_OK);
+    EXPECT_EQ(symtable_push_scope(), E_OK);
+    EXPECT_EQ(symtable_put_symbol(id("f"), (ast_node_t *) &data2), E_OK);
+    EXPECT_EQ(symtable_put_in_global(id("f"), (ast_node_t *) &data1), E_OK);
+    EXPECT_EQ(symtable_put_in_global(id("g"), (ast_node_t *) &data1), E_OK);
+
+    test_data_t *ref = (test_data_t *) symtable_find(id("f"));
+    ASSERT_NE(ref, nullptr);
+    EXPECT_EQ(ref->name, data2.name);
+    ref = (test_data_t *) symtable_find_in_global(id("f"));
+    ASSERT_NE(ref, nullptr);
+    EXPECT_EQ(ref->name, data1.name);
+    EXPECT_EQ(symtable_find_in_current(id("g")), nullptr);
+
+    EXPECT_EQ(symtable_pop_scope(), E_OK);
+    EXPECT_EQ(symtable_pop_scope(), E_OK);
+    ref = (test_data_t *) symtable_find_in_current(id("f"));
+    ASSERT_NE(ref, nullptr);
+    EXPECT_EQ(ref->name, data1.name);
+    ref = (test_data_t *) symtable_find(id("g"));
+    ASSERT_NE(ref, nullptr);
+    EXPECT_EQ(ref->name, data1.name);
+}
+
+TEST_F(EmptySymtable, DeepNesting)
+{
+    std::vector<test_data_t> data;
+    for(int i = 0; i < 1000; i++) {
+        data.emplace_back("v#" + std::to_string(i));
+    }
+    for(int i = 0; i < 1000; i++) {
+        EXPECT_EQ(symtable_push_scope(), E_OK);
+        EXPECT_EQ(symtable_put_symbol(id("v"), (ast_node_t *) &data[i]), E_OK);
+    }
+    for(int i = 999; i >= 0; i--) {
+        test_data_t *ref = (test_data_t *) symtable_find(id("v"));
+        ASSERT_NE(ref, nullptr);
+        EXPECT_EQ(ref->name, data[i].name);
+        EXPECT_EQ(symtable_pop_scope(), E_OK);
+    }
+    EXPECT_EQ(symtable_find(id("v")), nullptr);
+}
+
+TEST(Atom, EqualStringsShareAtom)
+{
+    atom_t a = atom_intern("counter", 7);
+    atom_t b = atom_intern_cstr("counter");
+    atom_t c = atom_intern("counter_", 7);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a, c);
+    EXPECT_NE(a, atom_intern_cstr("count"));
+    EXPECT_EQ(a->length, 7u);
+    EXPECT_STREQ(a->str, "counter");
+}
+
+TEST(Atom, Concat)
+{
+    atom_t a = atom_intern_cstr("i");
+    atom_t b = atom_concat(a, "%1");
+    ASSERT_NE(b, nullptr);
+    EXPECT_STREQ(b->str, "i%1");
+    EXPECT_EQ(b, atom_intern_cstr("i%1"));
+    EXPECT_EQ(b, atom_concat(a, "%1"));
+}
+
+TEST(Atom, ManyAtoms)
+{
+    std::vector<atom_t> atoms;
+    for(int i = 0; i < 10000; i++) {
+        atoms.push_back(atom_intern_cstr(("id" + std::to_string(i)).c_str()));
+        ASSERT_NE(atoms.back(), nullptr);
+    }
+    for(int i = 0; i < 10000; i++) {
+        EXPECT_EQ(atoms[i], atom_intern_cstr(("id" + std::to_string(i)).c_str()));
+    }
 }